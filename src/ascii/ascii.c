@@ -0,0 +1,1030 @@
+/******************************************************************************/
+/*                                                                            */
+/*  \file       ascii.c                                                       */
+/*  \date       Oct 2026                                                      */
+/*  \author     Severin Leven                                                 */
+/*                                                                            */
+/*  \brief      ASCII number conversion library                               */
+/*                                                                            */
+/*              Allocation-free replacements for sscanf()/sprintf() in        */
+/*              Lasso host's ASCII processing mode.                           */
+/*                                                                            */
+/*  This file is part of the Lasso host library. Lasso is a configurable and  */
+/*  efficient mechanism for data transfer between a host (server) and client. */
+/*                                                                            */
+/*  All private and public API definitions, typedefs, variables, structs and  */
+/*  functions related to ASCII number conversion are collected here.          */
+/*                                                                            */
+/******************************************************************************/
+/*                                                                            */
+/*  Target CPU: any 32-bit                                                    */
+/*  Ressources: CPU                                                           */
+/*                                                                            */
+/******************************************************************************/
+/*                                                                            */
+/*  Conversions                                                               */
+/*  - integers: decimal only, run time proportional to number of digits       */
+/*  - floats: printed in fixed point with LASSO_HOST_ASCII_FLOAT_DECIMALS     */
+/*    decimals; with LASSO_HOST_ASCII_FIXED_POINT, the value is decomposed    */
+/*    from its IEEE-754 bits with integer arithmetic only (no FPU or soft-    */
+/*    float library required), otherwise with float arithmetic              */
+/*  - no locale, no heap, no stdio                                            */
+/*                                                                            */
+/******************************************************************************/
+
+
+//----------//
+// Includes //
+//----------//
+
+#include "lasso_host.h"
+#include "lasso_defaults.h"
+
+#if (LASSO_HOST_ASCII_BUILTIN == 1)
+
+#include <string.h>
+#include "ascii/ascii.h"
+
+
+//-----------------//
+// Private defines //
+//-----------------//
+
+#define ASCII_IS_DIGIT(c)   (((c) >= '0') && ((c) <= '9'))
+#define ASCII_IS_SPACE(c)   (((c) == ' ') || (((c) >= '\t') && ((c) <= '\r')))
+
+// sign of negative zero (without math library)
+#define ASCII_SIGNBIT(v)    (((const uint8_t*)&(v))[ASCII_SIGN_BYTE] & 0x80)
+#if defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__)
+    #define ASCII_SIGN_BYTE (0)
+#else
+    #define ASCII_SIGN_BYTE (sizeof(double) - 1)
+#endif
+
+// significant digits accumulated by float parser (fit into uint64_t)
+#define ASCII_MAX_DIGITS    (19)
+
+// float parser scaling: 128-bit number in 16-bit limbs, least significant
+// first (32-bit arithmetic only)
+#define ASCII_LIMBS         (8)
+
+
+//-------------------//
+// Private variables //
+//-------------------//
+
+// powers of ten for fraction scaling
+static const uint32_t ASCII_pow10[10] = {
+    1, 10, 100, 1000, 10000, 100000, 1000000, 10000000, 100000000, 1000000000
+};
+
+// powers of ten exactly representable as double (float parser fast path),
+// up to 1e10 also as float
+static const double ASCII_exact10[23] = {
+    1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+    1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+};
+
+
+//-------------------//
+// Private functions //
+//-------------------//
+
+/*!
+ *  Parse optional white space and sign of a number.
+ *
+ *  \return Number of chars consumed
+ */
+static uint32_t ASCII_parse_sign (
+    const char* src,        //!< source string
+    bool* neg               //!< '-' sign found
+) {
+    const char* cp = src;
+
+    while (ASCII_IS_SPACE(*cp)) {
+        cp++;
+    }
+
+    *neg = (*cp == '-');
+    if ((*cp == '-') || (*cp == '+')) {
+        cp++;
+    }
+
+    return (uint32_t)(cp - src);
+}
+
+
+/*!
+ *  Parse decimal digits into a 64-bit accumulator (modulo 2^64).
+ *
+ *  \return Number of chars consumed, 0 if none found
+ */
+static uint32_t ASCII_parse_digits (
+    const char* src,        //!< source string
+    uint64_t* dest          //!< parsed value
+) {
+    const char* cp = src;
+    uint64_t v = 0;
+
+    while (ASCII_IS_DIGIT(*cp)) {
+        v = v * 10 + (uint64_t)(*cp++ - '0');
+    }
+
+    *dest = v;
+    return (uint32_t)(cp - src);
+}
+
+
+/*!
+ *  Parse signed decimal integer (modulo 2^64).
+ *
+ *  \return Number of chars consumed, 0 if no number found
+ */
+static uint32_t ASCII_parse_integer (
+    const char* src,        //!< source string
+    uint64_t* dest          //!< parsed value (two's complement)
+) {
+    bool neg;
+    uint32_t n = ASCII_parse_sign(src, &neg);
+    uint32_t d = ASCII_parse_digits(src + n, dest);
+
+    if (d == 0) {
+        return 0;
+    }
+
+    if (neg) {
+        *dest = ~*dest + 1;
+    }
+
+    return n + d;
+}
+
+
+/*!
+ *  Number of significant bits of 128-bit number.
+ *
+ *  \return Bit length, 0 if number is zero
+ */
+static uint32_t ASCII_bit_length (
+    const uint32_t* x       //!< number (ASCII_LIMBS limbs)
+) {
+    uint32_t i = ASCII_LIMBS;
+    uint32_t w;
+    uint32_t n;
+
+    while (i && (x[i - 1] == 0)) {
+        i--;
+    }
+    if (i == 0) {
+        return 0;
+    }
+
+    n = 16 * (i - 1);
+    for (w = x[i - 1]; w; w >>= 1) {
+        n++;
+    }
+    return n;
+}
+
+
+/*!
+ *  Shift 128-bit number left (caller ensures no bits are lost).
+ */
+static void ASCII_shift_left (
+    uint32_t* x,            //!< number (ASCII_LIMBS limbs)
+    uint32_t n              //!< bits to shift (< 128)
+) {
+    uint32_t q = n >> 4;
+    uint32_t r = n & 15;
+    uint32_t i = ASCII_LIMBS;
+
+    while (i--) {
+        uint32_t hi = (i >= q) ? x[i - q] : 0;
+        uint32_t lo = (i >= q + 1) ? x[i - q - 1] : 0;
+        x[i] = ((hi << r) | (lo >> (16 - r))) & 0xFFFF;
+    }
+}
+
+
+/*!
+ *  Shift 128-bit number right, shifted out bits or'ed into sticky flag.
+ */
+static void ASCII_shift_right (
+    uint32_t* x,            //!< number (ASCII_LIMBS limbs)
+    uint32_t n,             //!< bits to shift (<= 128)
+    bool* sticky            //!< set if a non-zero bit is shifted out
+) {
+    uint32_t q = n >> 4;
+    uint32_t r = n & 15;
+    uint32_t i;
+
+    for (i = 0; (i < q) && (i < ASCII_LIMBS); i++) {
+        *sticky |= (x[i] != 0);
+    }
+    if (q < ASCII_LIMBS) {
+        *sticky |= ((x[q] & ((1u << r) - 1)) != 0);
+    }
+
+    for (i = 0; i < ASCII_LIMBS; i++) {
+        uint32_t lo = (i + q < ASCII_LIMBS) ? x[i + q] : 0;
+        uint32_t hi = (i + q + 1 < ASCII_LIMBS) ? x[i + q + 1] : 0;
+        x[i] = ((lo >> r) | (hi << (16 - r))) & 0xFFFF;
+    }
+}
+
+
+/*!
+ *  Convert m * 10^e10 to IEEE-754 binary format (double: 53 bits precision,
+ *  largest exponent 1023; float: 24, 127), rounded once to nearest even.
+ *
+ *  The product is scaled in 128 bits by factors of 5 (powers of two go to
+ *  the binary exponent); bits lost in scaling, and non-zero digits dropped
+ *  by the parser, are kept as sticky flag for the final rounding.
+ *
+ *  \return Encoding of value (positive, may be zero or infinity)
+ */
+static uint64_t ASCII_scale_decimal (
+    uint64_t m,             //!< decimal mantissa (> 0)
+    int32_t e10,            //!< decimal exponent
+    bool sticky,            //!< non-zero digits dropped after mantissa
+    int32_t mant,           //!< bits of precision (incl. hidden bit)
+    int32_t emax            //!< largest binary exponent
+) {
+    uint32_t x[ASCII_LIMBS] = { 0 };
+    int32_t e2 = 0;         // value = x * 2^e2
+    int32_t ex;
+    int32_t prec;
+    uint32_t len;
+    uint32_t c;
+    uint32_t i;
+    uint64_t bits;
+
+    // m >= 1 (and < 10^19): limit scaling to where result is inf or zero
+    if (e10 > 309) {
+        e10 = 309;
+    }
+    if (e10 < -344) {
+        e10 = -344;
+    }
+
+    for (i = 0; i < 4; i++) {
+        x[i] = (uint32_t)(m >> (16 * i)) & 0xFFFF;
+    }
+
+    while (e10 > 0) {
+        if (x[ASCII_LIMBS - 1] >> 13) {
+            ASCII_shift_right(x, 3, &sticky);       // headroom for factor 5
+            e2 += 3;
+        }
+        c = 0;
+        for (i = 0; i < ASCII_LIMBS; i++) {
+            c += x[i] * 5;
+            x[i] = c & 0xFFFF;
+            c >>= 16;
+        }
+        e2++;
+        e10--;
+    }
+    while (e10 < 0) {
+        len = 128 - ASCII_bit_length(x);            // full precision for quotient
+        ASCII_shift_left(x, len);
+        e2 -= (int32_t)len;
+        c = 0;
+        for (i = ASCII_LIMBS; i--; ) {
+            c = (c << 16) | x[i];
+            x[i] = c / 5;
+            c %= 5;
+        }
+        sticky |= (c != 0);
+        e2--;
+        e10++;
+    }
+
+    // normalize to 128 bits, value in [2^ex, 2^(ex+1))
+    len = 128 - ASCII_bit_length(x);
+    ASCII_shift_left(x, len);
+    e2 -= (int32_t)len;
+    ex = e2 + 127;
+
+    // full precision, less for subnormals (below exponent 1 - emax)
+    prec = (ex < 1 - emax) ? mant + ex + emax - 1 : mant;
+    if (prec < 0) {
+        return 0;                                   // below half the smallest subnormal
+    }
+
+    // keep prec + 1 bits, round half to even on the last one
+    ASCII_shift_right(x, 127 - (uint32_t)prec, &sticky);
+    bits = 0;
+    for (i = 4; i--; ) {
+        bits = (bits << 16) | x[i];
+    }
+    c = (uint32_t)bits & 1;
+    bits >>= 1;
+    if (c && (sticky || (bits & 1))) {
+        bits++;
+    }
+
+    // subnormals: bits are the encoding (carry into smallest normal included)
+    if (prec == mant) {
+        if (bits >> mant) {                         // rounded up to next power of two
+            bits >>= 1;
+            ex++;
+        }
+        if (ex > emax) {
+            ex = emax + 1;                          // infinity
+            bits = 0;
+        }
+        bits = ((uint64_t)(ex + emax) << (mant - 1)) | (bits & ((1ull << (mant - 1)) - 1));
+    }
+
+    return bits;
+}
+
+
+/*!
+ *  Parse decimal floating point number into mantissa and decimal exponent.
+ *
+ *  Keeps the first ASCII_MAX_DIGITS significant digits, notes any non-zero
+ *  digit dropped after these.
+ *
+ *  \return Number of chars consumed, 0 if no number found
+ */
+static uint32_t ASCII_parse_decimal (
+    const char* src,        //!< source string
+    bool* neg,              //!< '-' sign found
+    uint64_t* m,            //!< decimal mantissa
+    int32_t* e10,           //!< decimal exponent
+    bool* dropped           //!< non-zero digits dropped after mantissa
+) {
+    const char* cp;
+    bool eneg;
+    uint64_t e;
+    uint32_t digits = 0;
+    uint32_t sig = 0;
+    uint32_t n;
+
+    *m = 0;
+    *e10 = 0;
+    *dropped = false;
+
+    cp = src + ASCII_parse_sign(src, neg);
+    while (ASCII_IS_DIGIT(*cp)) {
+        if (sig < ASCII_MAX_DIGITS) {
+            *m = *m * 10 + (uint64_t)(*cp - '0');
+            sig += (*m != 0);
+        }
+        else {
+            *dropped |= (*cp != '0');
+            (*e10)++;
+        }
+        cp++;
+        digits++;
+    }
+    if (*cp == '.') {
+        cp++;
+        while (ASCII_IS_DIGIT(*cp)) {
+            if (sig < ASCII_MAX_DIGITS) {
+                *m = *m * 10 + (uint64_t)(*cp - '0');
+                sig += (*m != 0);
+                (*e10)--;
+            }
+            else {
+                *dropped |= (*cp != '0');
+            }
+            cp++;
+            digits++;
+        }
+    }
+    if (digits == 0) {
+        return 0;
+    }
+
+    // exponent (ignored if malformed, as with sscanf)
+    if ((*cp == 'e') || (*cp == 'E')) {
+        n = 1;
+        if ((cp[n] == '-') || (cp[n] == '+')) {
+            eneg = (cp[n++] == '-');
+        }
+        else {
+            eneg = false;
+        }
+        digits = ASCII_parse_digits(cp + n, &e);
+        if (digits) {
+            n += digits;
+            if (e > 9999) {
+                e = 9999;
+            }
+            *e10 += eneg ? -(int32_t)e : (int32_t)e;
+            cp += n;
+        }
+    }
+
+    return (uint32_t)(cp - src);
+}
+
+
+/*!
+ *  Append separator and null-terminator.
+ *
+ *  \return Number of chars printed (excluding null-terminator)
+ */
+static uint32_t ASCII_terminate (
+    char* dest,             //!< destination buffer
+    uint32_t len,           //!< chars printed so far
+    char sep                //!< separator appended (0 = none)
+) {
+    if (sep) {
+        dest[len++] = sep;
+    }
+    dest[len] = 0;
+
+    return len;
+}
+
+
+/*!
+ *  Print unsigned 64-bit integer in decimal, without termination.
+ *
+ *  \return Number of chars printed
+ */
+static uint32_t ASCII_print_digits (
+    char* dest,             //!< destination buffer
+    uint64_t v              //!< value
+) {
+    char tmp[20];
+    uint32_t n = 0;
+    uint32_t len;
+
+    // 32-bit division where possible (no 64-bit division library call)
+    while (v > 0xFFFFFFFFu) {
+        tmp[n++] = (char)('0' + (v % 10));
+        v /= 10;
+    }
+    {
+        uint32_t w = (uint32_t)v;
+        do {
+            tmp[n++] = (char)('0' + (w % 10));
+            w /= 10;
+        } while (w);
+    }
+
+    len = n;
+    while (n) {
+        *dest++ = tmp[--n];
+    }
+
+    return len;
+}
+
+
+/*!
+ *  Print integer and fraction parts with LASSO_HOST_ASCII_FLOAT_DECIMALS
+ *  decimals, without termination.
+ *
+ *  \return Number of chars printed
+ */
+static uint32_t ASCII_print_fixed (
+    char* dest,             //!< destination buffer
+    uint64_t ip,            //!< integer part
+    uint32_t fp             //!< fraction in decimals (< 10^decimals)
+) {
+    uint32_t len = ASCII_print_digits(dest, ip);
+#if (LASSO_HOST_ASCII_FLOAT_DECIMALS > 0)
+    uint32_t i;
+
+    dest[len++] = '.';
+    for (i = LASSO_HOST_ASCII_FLOAT_DECIMALS; i > 0; i--) {
+        dest[len + i - 1] = (char)('0' + (fp % 10));
+        fp /= 10;
+    }
+    len += LASSO_HOST_ASCII_FLOAT_DECIMALS;
+#else
+    (void)fp;
+#endif
+
+    return len;
+}
+
+
+/*!
+ *  Print uint64 mantissa times 10^e10 as d.ddde+XX (mantissa rounded),
+ *  without termination.
+ *
+ *  \return Number of chars printed
+ */
+static uint32_t ASCII_print_exponent (
+    char* dest,             //!< destination buffer
+    uint64_t m,             //!< decimal mantissa
+    int32_t e10             //!< decimal exponent
+) {
+    char tmp[20];
+    uint32_t n;
+    uint32_t len = 0;
+#if (LASSO_HOST_ASCII_FLOAT_DECIMALS > 0)
+    uint32_t i;
+#endif
+
+    // round to 1 + LASSO_HOST_ASCII_FLOAT_DECIMALS significant digits
+    while (m >= (uint64_t)ASCII_pow10[LASSO_HOST_ASCII_FLOAT_DECIMALS] * 100) {
+        m /= 10;
+        e10++;
+    }
+    if (m >= (uint64_t)ASCII_pow10[LASSO_HOST_ASCII_FLOAT_DECIMALS] * 10) {
+        m = (m + 5) / 10;
+        e10++;
+    }
+    n = ASCII_print_digits(tmp, m);
+
+    dest[len++] = tmp[0];
+#if (LASSO_HOST_ASCII_FLOAT_DECIMALS > 0)
+    dest[len++] = '.';
+    for (i = 1; i <= LASSO_HOST_ASCII_FLOAT_DECIMALS; i++) {
+        dest[len++] = (i < n) ? tmp[i] : '0';
+    }
+#endif
+    e10 += (int32_t)n - 1;
+
+    dest[len++] = 'e';
+    dest[len++] = (e10 < 0) ? '-' : '+';
+    if (e10 < 0) {
+        e10 = -e10;
+    }
+    if (e10 < 10) {
+        dest[len++] = '0';
+    }
+    len += ASCII_print_digits(dest + len, (uint64_t)e10);
+
+    return len;
+}
+
+
+/*!
+ *  Print special floating point values, without termination.
+ *
+ *  \return Number of chars printed
+ */
+static uint32_t ASCII_print_special (
+    char* dest,             //!< destination buffer
+    bool nan                //!< NaN (true) or infinity (false)
+) {
+    memcpy(dest, nan ? "nan" : "inf", 3);
+    return 3;
+}
+
+
+/*!
+ *  Round binary fraction fb * 2^-sh to LASSO_HOST_ASCII_FLOAT_DECIMALS
+ *  decimals, half to even (as printf), carry into integer part. Exact: the
+ *  fraction is held in 0.120 fixed point, which keeps every bit that can
+ *  decide a tie.
+ *
+ *  \return Fraction decimals
+ */
+static uint32_t ASCII_round_fraction (
+    uint64_t fb,            //!< fraction bits (< 2^sh and < 2^60)
+    uint32_t sh,            //!< binary fraction digits
+    uint64_t* ip            //!< integer part (incremented on carry)
+) {
+    const uint64_t mask = ((uint64_t)1 << 60) - 1;
+    uint64_t hi;
+    uint64_t lo;
+    uint32_t fp = 0;
+    uint32_t i;
+
+    if (sh <= 60) {
+        hi = fb << (60 - sh);
+        lo = 0;
+    }
+    else if (sh <= 120) {
+        hi = fb >> (sh - 60);
+        lo = (fb & (((uint64_t)1 << (sh - 60)) - 1)) << (120 - sh);
+    }
+    else {
+        hi = 0;     // < 2^-60, never reaches half a decimal
+        lo = 0;
+    }
+
+    for (i = 0; i < LASSO_HOST_ASCII_FLOAT_DECIMALS; i++) {
+        lo *= 10;
+        hi  = hi * 10 + (lo >> 60);
+        lo &= mask;
+        fp  = fp * 10 + (uint32_t)(hi >> 60);
+        hi &= mask;
+    }
+
+    if ((hi > ((uint64_t)1 << 59)) ||
+        ((hi == ((uint64_t)1 << 59)) && (lo || (fp & 1) ||
+        ((LASSO_HOST_ASCII_FLOAT_DECIMALS == 0) && (*ip & 1))))) {
+        if (++fp >= ASCII_pow10[LASSO_HOST_ASCII_FLOAT_DECIMALS]) {
+            fp = 0;
+            (*ip)++;
+        }
+    }
+
+    return fp;
+}
+
+
+#if (LASSO_HOST_ASCII_FIXED_POINT == 1)
+/*!
+ *  Print m * 2^k with integer arithmetic only, without termination.
+ *
+ *  \return Number of chars printed
+ */
+static uint32_t ASCII_print_binary (
+    char* dest,             //!< destination buffer
+    uint64_t m,             //!< binary mantissa (< 2^53)
+    int32_t k               //!< binary exponent
+) {
+    uint64_t ip;
+    uint32_t fp;
+    int32_t e10 = 0;
+
+    if ((k > 63) || ((k > 0) && (m >> (64 - k)))) {
+        // 2^64 and more: shift left into top bits, trade bits for decimals
+        while (k > 0) {
+            if (m >> 60) {
+                m /= 10;
+                e10++;
+            }
+            else {
+                m <<= 1;
+                k--;
+            }
+        }
+        return ASCII_print_exponent(dest, m, e10);
+    }
+
+    if (k >= 0) {
+        ip = m << k;
+        fp = 0;
+    }
+    else {
+        uint32_t sh = (uint32_t)-k;
+
+        ip = (sh < 64) ? (m >> sh) : 0;
+        fp = ASCII_round_fraction((sh < 64) ? (m & (((uint64_t)1 << sh) - 1)) : m, sh, &ip);
+    }
+
+    return ASCII_print_fixed(dest, ip, fp);
+}
+#endif
+
+
+//------------------//
+// Public functions //
+//------------------//
+
+uint32_t ASCII_parse_uint32 (
+    const char* src,        //!< source string
+    uint32_t* dest          //!< parsed value (unchanged if none found)
+) {
+    uint64_t v;
+    uint32_t n = ASCII_parse_integer(src, &v);
+
+    if (n) {
+        *dest = (uint32_t)v;
+    }
+    return n;
+}
+
+
+uint32_t ASCII_parse_int32 (
+    const char* src,        //!< source string
+    int32_t* dest           //!< parsed value (unchanged if none found)
+) {
+    uint64_t v;
+    uint32_t n = ASCII_parse_integer(src, &v);
+
+    if (n) {
+        *dest = (int32_t)(uint32_t)v;
+    }
+    return n;
+}
+
+
+uint32_t ASCII_parse_uint16 (
+    const char* src,        //!< source string
+    uint16_t* dest          //!< parsed value (unchanged if none found)
+) {
+    uint64_t v;
+    uint32_t n = ASCII_parse_integer(src, &v);
+
+    if (n) {
+        *dest = (uint16_t)v;
+    }
+    return n;
+}
+
+
+uint32_t ASCII_parse_int16 (
+    const char* src,        //!< source string
+    int16_t* dest           //!< parsed value (unchanged if none found)
+) {
+    uint64_t v;
+    uint32_t n = ASCII_parse_integer(src, &v);
+
+    if (n) {
+        *dest = (int16_t)(uint16_t)v;
+    }
+    return n;
+}
+
+
+uint32_t ASCII_parse_uint64 (
+    const char* src,        //!< source string
+    uint64_t* dest          //!< parsed value (unchanged if none found)
+) {
+    return ASCII_parse_integer(src, dest);
+}
+
+
+uint32_t ASCII_parse_int64 (
+    const char* src,        //!< source string
+    int64_t* dest           //!< parsed value (unchanged if none found)
+) {
+    uint64_t v;
+    uint32_t n = ASCII_parse_integer(src, &v);
+
+    if (n) {
+        *dest = (int64_t)v;
+    }
+    return n;
+}
+
+
+uint32_t ASCII_parse_double (
+    const char* src,        //!< source string
+    double* dest            //!< parsed value (unchanged if none found)
+) {
+    bool neg;
+    bool dropped;
+    uint64_t m;
+    uint64_t bits;
+    int32_t e10;
+    uint32_t n = ASCII_parse_decimal(src, &neg, &m, &e10, &dropped);
+    double v;
+
+    if (n == 0) {
+        return 0;
+    }
+
+    // scale, rounded once: directly if mantissa and power of ten are exact
+    // doubles, otherwise in 128 bits
+    if (m == 0) {
+        v = 0;
+    }
+    else if ((m < (1ull << 53)) && (e10 >= -22) && (e10 <= 22)) {
+        v = (double)m;
+        if (e10 > 0) {
+            v *= ASCII_exact10[e10];
+        }
+        else if (e10 < 0) {
+            v /= ASCII_exact10[-e10];
+        }
+    }
+    else {
+        bits = ASCII_scale_decimal(m, e10, dropped, 53, 1023);
+        memcpy(&v, &bits, sizeof(v));
+    }
+
+    *dest = neg ? -v : v;
+    return n;
+}
+
+
+uint32_t ASCII_parse_float (
+    const char* src,        //!< source string
+    float* dest             //!< parsed value (unchanged if none found)
+) {
+    bool neg;
+    bool dropped;
+    uint64_t m;
+    uint32_t bits;
+    int32_t e10;
+    uint32_t n = ASCII_parse_decimal(src, &neg, &m, &e10, &dropped);
+    float v;
+
+    if (n == 0) {
+        return 0;
+    }
+
+    // scale, rounded once (not via double, which would round twice): directly
+    // if mantissa and power of ten are exact floats, otherwise in 128 bits
+    if (m == 0) {
+        v = 0;
+    }
+    else if ((m < (1ul << 24)) && (e10 >= -10) && (e10 <= 10)) {
+        v = (float)m;
+        if (e10 > 0) {
+            v *= (float)ASCII_exact10[e10];
+        }
+        else if (e10 < 0) {
+            v /= (float)ASCII_exact10[-e10];
+        }
+    }
+    else {
+        bits = (uint32_t)ASCII_scale_decimal(m, e10, dropped, 24, 127);
+        memcpy(&v, &bits, sizeof(v));
+    }
+
+    *dest = neg ? -v : v;
+    return n;
+}
+
+
+uint32_t ASCII_print_uint32 (
+    char* dest,             //!< destination buffer
+    uint32_t v,             //!< value
+    char sep                //!< separator appended (0 = none)
+) {
+    return ASCII_terminate(dest, ASCII_print_digits(dest, v), sep);
+}
+
+
+uint32_t ASCII_print_int32 (
+    char* dest,             //!< destination buffer
+    int32_t v,              //!< value
+    char sep                //!< separator appended (0 = none)
+) {
+    uint32_t len = 0;
+    uint32_t u = (uint32_t)v;
+
+    if (v < 0) {
+        dest[len++] = '-';
+        u = ~u + 1;
+    }
+
+    len += ASCII_print_digits(dest + len, u);
+    return ASCII_terminate(dest, len, sep);
+}
+
+
+uint32_t ASCII_print_uint64 (
+    char* dest,             //!< destination buffer
+    uint64_t v,             //!< value
+    char sep                //!< separator appended (0 = none)
+) {
+    return ASCII_terminate(dest, ASCII_print_digits(dest, v), sep);
+}
+
+
+uint32_t ASCII_print_int64 (
+    char* dest,             //!< destination buffer
+    int64_t v,              //!< value
+    char sep                //!< separator appended (0 = none)
+) {
+    uint32_t len = 0;
+    uint64_t u = (uint64_t)v;
+
+    if (v < 0) {
+        dest[len++] = '-';
+        u = ~u + 1;
+    }
+
+    len += ASCII_print_digits(dest + len, u);
+    return ASCII_terminate(dest, len, sep);
+}
+
+
+uint32_t ASCII_print_char (
+    char* dest,             //!< destination buffer
+    char c,                 //!< char
+    char sep                //!< separator appended (0 = none)
+) {
+    dest[0] = c;
+    return ASCII_terminate(dest, 1, sep);
+}
+
+
+uint32_t ASCII_print_string (
+    char* dest,             //!< destination buffer
+    const char* src,        //!< source string
+    char sep                //!< separator appended (0 = none)
+) {
+    uint32_t len = 0;
+
+    while (src[len]) {
+        dest[len] = src[len];
+        len++;
+    }
+
+    return ASCII_terminate(dest, len, sep);
+}
+
+
+uint32_t ASCII_print_double (
+    char* dest,             //!< destination buffer
+    double v,               //!< value
+    char sep                //!< separator appended (0 = none)
+) {
+    uint32_t len = 0;
+#if (LASSO_HOST_ASCII_FIXED_POINT == 1)
+    uint64_t bits;
+    uint32_t ex;
+    uint64_t m;
+
+    memcpy(&bits, &v, sizeof(bits));
+    ex = (uint32_t)(bits >> 52) & 0x7FF;
+    m  = bits & 0x000FFFFFFFFFFFFFull;
+
+    if (bits >> 63) {
+        dest[len++] = '-';
+    }
+
+    if (ex == 0x7FF) {
+        len += ASCII_print_special(dest + len, m != 0);
+    }
+    else if (ex == 0) {
+        len += ASCII_print_binary(dest + len, m, -1074);        // subnormal
+    }
+    else {
+        len += ASCII_print_binary(dest + len, m | (1ull << 52), (int32_t)ex - 1075);
+    }
+#else
+    uint64_t ip;
+    uint32_t fp;
+    int32_t e10 = 0;
+
+    if (v != v) {
+        return ASCII_terminate(dest, ASCII_print_special(dest, true), sep);
+    }
+
+    if ((v < 0) || ((v == 0) && ASCII_SIGNBIT(v))) {
+        dest[len++] = '-';
+        v = -v;
+    }
+
+    if (v >= 18446744073709551616.0) {
+        if (v > 1.7976931348623157e308) {
+            len += ASCII_print_special(dest + len, false);
+        }
+        else {
+            // reduce to 19 integer digits, decimals taken from these
+            while (v >= 1e19) {
+                v /= 10;
+                e10++;
+            }
+            len += ASCII_print_exponent(dest + len, (uint64_t)v, e10);
+        }
+    }
+    else {
+        double f;
+        uint64_t bits;
+        uint32_t ex;
+
+        // fraction is exact, rounded on its mantissa bits
+        ip = (uint64_t)v;
+        f  = v - (double)ip;
+        memcpy(&bits, &f, sizeof(bits));
+        ex = (uint32_t)(bits >> 52) & 0x7FF;
+        if (ex == 0) {
+            fp = ASCII_round_fraction(bits & 0x000FFFFFFFFFFFFFull, 1074, &ip);
+        }
+        else {
+            fp = ASCII_round_fraction((bits & 0x000FFFFFFFFFFFFFull) | (1ull << 52), 1075 - ex, &ip);
+        }
+        len += ASCII_print_fixed(dest + len, ip, fp);
+    }
+#endif
+
+    return ASCII_terminate(dest, len, sep);
+}
+
+
+uint32_t ASCII_print_float (
+    char* dest,             //!< destination buffer
+    float v,                //!< value
+    char sep                //!< separator appended (0 = none)
+) {
+#if (LASSO_HOST_ASCII_FIXED_POINT == 1)
+    uint32_t len = 0;
+    uint32_t bits;
+    uint32_t ex;
+    uint32_t m;
+
+    memcpy(&bits, &v, sizeof(bits));
+    ex = (bits >> 23) & 0xFF;
+    m  = bits & 0x007FFFFF;
+
+    if (bits >> 31) {
+        dest[len++] = '-';
+    }
+
+    if (ex == 0xFF) {
+        len += ASCII_print_special(dest + len, m != 0);
+    }
+    else if (ex == 0) {
+        len += ASCII_print_binary(dest + len, m, -149);         // subnormal
+    }
+    else {
+        len += ASCII_print_binary(dest + len, m | (1u << 23), (int32_t)ex - 150);
+    }
+
+    return ASCII_terminate(dest, len, sep);
+#else
+    return ASCII_print_double(dest, (double)v, sep);
+#endif
+}
+
+#endif
@@ -0,0 +1,236 @@
+/******************************************************************************/
+/*                                                                            */
+/*  \file       ascii.h                                                       */
+/*  \date       Oct 2026                                                      */
+/*  \author     Severin Leven                                                 */
+/*                                                                            */
+/*  \brief      ASCII number conversion library API                           */
+/*                                                                            */
+/*              Allocation-free replacements for sscanf()/sprintf() in        */
+/*              Lasso host's ASCII processing mode.                           */
+/*                                                                            */
+/*  This file is part of the Lasso host library. Lasso is a configurable and  */
+/*  efficient mechanism for data transfer between a host (server) and client. */
+/*                                                                            */
+/*  All public API definitions, typedefs, variables, structs and functions    */
+/*  related to ASCII number conversion are collected here.                    */
+/*                                                                            */
+/******************************************************************************/
+/*                                                                            */
+/*  Target CPU: any 32-bit                                                    */
+/*  Ressources: CPU                                                           */
+/*                                                                            */
+/******************************************************************************/
+
+#ifndef ASCII_H
+#define ASCII_H
+
+
+//----------//
+// Includes //
+//----------//
+
+#include <stdint.h>     // for int types
+
+
+//----------------------//
+// Public functions API //
+//----------------------//
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*!
+ *  \brief  Parse decimal unsigned integer (like sscanf "%lu").
+ *
+ *          Leading white space and sign are accepted, a '-' sign negates
+ *          the value (modulo 2^32), as with sscanf.
+ *
+ *  \return Number of chars consumed, 0 if no number found
+ */
+uint32_t ASCII_parse_uint32 (
+    const char* src,        //!< source string
+    uint32_t* dest          //!< parsed value (unchanged if none found)
+);
+
+/*!
+ *  \brief  Parse decimal signed integer (like sscanf "%li").
+ *
+ *          Unlike "%li", numbers with leading 0 or 0x are read as decimal.
+ *
+ *  \return Number of chars consumed, 0 if no number found
+ */
+uint32_t ASCII_parse_int32 (
+    const char* src,        //!< source string
+    int32_t* dest           //!< parsed value (unchanged if none found)
+);
+
+/*!
+ *  \brief  Parse decimal unsigned 16-bit integer (like sscanf "%hu").
+ *
+ *  \return Number of chars consumed, 0 if no number found
+ */
+uint32_t ASCII_parse_uint16 (
+    const char* src,        //!< source string
+    uint16_t* dest          //!< parsed value (unchanged if none found)
+);
+
+/*!
+ *  \brief  Parse decimal signed 16-bit integer (like sscanf "%hi").
+ *
+ *  \return Number of chars consumed, 0 if no number found
+ */
+uint32_t ASCII_parse_int16 (
+    const char* src,        //!< source string
+    int16_t* dest           //!< parsed value (unchanged if none found)
+);
+
+/*!
+ *  \brief  Parse decimal unsigned 64-bit integer (like sscanf "%Lu").
+ *
+ *  \return Number of chars consumed, 0 if no number found
+ */
+uint32_t ASCII_parse_uint64 (
+    const char* src,        //!< source string
+    uint64_t* dest          //!< parsed value (unchanged if none found)
+);
+
+/*!
+ *  \brief  Parse decimal signed 64-bit integer (like sscanf "%Li").
+ *
+ *  \return Number of chars consumed, 0 if no number found
+ */
+uint32_t ASCII_parse_int64 (
+    const char* src,        //!< source string
+    int64_t* dest           //!< parsed value (unchanged if none found)
+);
+
+/*!
+ *  \brief  Parse floating point number (like sscanf "%lf").
+ *
+ *          Accepts [sign] digits [. digits] [e|E [sign] digits]. Correctly
+ *          rounded for up to 19 significant digits; further digits only
+ *          break ties. "inf" and "nan" are rejected.
+ *
+ *  \return Number of chars consumed, 0 if no number found
+ */
+uint32_t ASCII_parse_double (
+    const char* src,        //!< source string
+    double* dest            //!< parsed value (unchanged if none found)
+);
+
+/*!
+ *  \brief  Parse floating point number (like sscanf "%f").
+ *
+ *          As ASCII_parse_double(), but rounded once to float precision
+ *          (not via double, which would round twice).
+ *
+ *  \return Number of chars consumed, 0 if no number found
+ */
+uint32_t ASCII_parse_float (
+    const char* src,        //!< source string
+    float* dest             //!< parsed value (unchanged if none found)
+);
+
+/*!
+ *  \brief  Print unsigned integer in decimal (like sprintf "%lu").
+ *
+ *          Separator sep is appended unless 0, output is null-terminated.
+ *
+ *  \return Number of chars printed (excluding null-terminator)
+ */
+uint32_t ASCII_print_uint32 (
+    char* dest,             //!< destination buffer
+    uint32_t v,             //!< value
+    char sep                //!< separator appended (0 = none)
+);
+
+/*!
+ *  \brief  Print signed integer in decimal (like sprintf "%li").
+ *
+ *  \return Number of chars printed (excluding null-terminator)
+ */
+uint32_t ASCII_print_int32 (
+    char* dest,             //!< destination buffer
+    int32_t v,              //!< value
+    char sep                //!< separator appended (0 = none)
+);
+
+/*!
+ *  \brief  Print unsigned 64-bit integer in decimal (like sprintf "%Lu").
+ *
+ *  \return Number of chars printed (excluding null-terminator)
+ */
+uint32_t ASCII_print_uint64 (
+    char* dest,             //!< destination buffer
+    uint64_t v,             //!< value
+    char sep                //!< separator appended (0 = none)
+);
+
+/*!
+ *  \brief  Print signed 64-bit integer in decimal (like sprintf "%Li").
+ *
+ *  \return Number of chars printed (excluding null-terminator)
+ */
+uint32_t ASCII_print_int64 (
+    char* dest,             //!< destination buffer
+    int64_t v,              //!< value
+    char sep                //!< separator appended (0 = none)
+);
+
+/*!
+ *  \brief  Print single char (like sprintf "%c").
+ *
+ *  \return Number of chars printed (excluding null-terminator)
+ */
+uint32_t ASCII_print_char (
+    char* dest,             //!< destination buffer
+    char c,                 //!< char
+    char sep                //!< separator appended (0 = none)
+);
+
+/*!
+ *  \brief  Print string (like sprintf "%s").
+ *
+ *  \return Number of chars printed (excluding null-terminator)
+ */
+uint32_t ASCII_print_string (
+    char* dest,             //!< destination buffer
+    const char* src,        //!< source string
+    char sep                //!< separator appended (0 = none)
+);
+
+/*!
+ *  \brief  Print floating point number with LASSO_HOST_ASCII_FLOAT_DECIMALS
+ *          decimals (like sprintf "%f" for 6 decimals).
+ *
+ *          Values of 2^64 and more are printed as d.ddde+XX.
+ *
+ *  \return Number of chars printed (excluding null-terminator)
+ */
+uint32_t ASCII_print_double (
+    char* dest,             //!< destination buffer
+    double v,               //!< value
+    char sep                //!< separator appended (0 = none)
+);
+
+/*!
+ *  \brief  Print floating point number, see ASCII_print_double().
+ *
+ *          With LASSO_HOST_ASCII_FIXED_POINT enabled, no floating point
+ *          arithmetic is used (no double conversion either).
+ *
+ *  \return Number of chars printed (excluding null-terminator)
+ */
+uint32_t ASCII_print_float (
+    char* dest,             //!< destination buffer
+    float v,                //!< value
+    char sep                //!< separator appended (0 = none)
+);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ASCII_H */
@@ -34,6 +34,20 @@
 // - if malloc() is used, sufficient heap must be allocated on host
 #define LASSO_HOST_MALLOC(x)                        malloc(x)
 
+// Lasso host arena:
+// - 0 = all Lasso host memory is allocated with LASSO_HOST_MALLOC
+// - 1 = data cells, frame buffers, tables and instances come from a single
+//   arena by bump pointer (aligned to LASSO_MEMORY_ALIGN, at least
+//   pointer width, never freed),
+//   LASSO_HOST_MALLOC is not used and need not be defined
+// - LASSO_HOST_ARENA_SIZE > 0: static arena of this size inside Lasso host,
+//   e.g. LASSO_HOST_ARENA_BYTES(cells, payload) for a conservative estimate
+// - LASSO_HOST_ARENA_SIZE = 0: user supplies the region with
+//   lasso_hostRegisterArena() before registering anything else
+// - lasso_hostGetArenaUsed() reports the exact number of Bytes consumed
+#define LASSO_HOST_ARENA                            (0)
+#define LASSO_HOST_ARENA_SIZE                       (0)
+
 // Lasso host memory access alignment:
 // - for optimal performance, Lasso accesses memory as Byte, Word or Longword
 // - some processor architectures prohibit unaligned Word and Longword access
@@ -58,6 +72,36 @@
 // - not mandatory (user can implement own timestamp)
 #define LASSO_HOST_TIMESTAMP                        (1)
 
+// Lasso host timestamp source:
+// - 0 = timestamp counts lasso ticks
+// - 1 = timestamp is latched from a free-running hardware timer when a
+//   strobe is sampled, see lasso_hostRegisterTIMER() (ticks are counted
+//   until a timer is registered)
+// - LASSO_HOST_TIMESTAMP_UNIT: unit string of timer counts, e.g. "us"
+// - LASSO_HOST_TIMESTAMP_64BIT: 64-bit timestamp data cell, a 32-bit timer
+//   is wrap-extended (it must not wrap more than once per lasso tick)
+#define LASSO_HOST_TIMESTAMP_TIMER                  (0)
+#define LASSO_HOST_TIMESTAMP_UNIT                   "us"
+#define LASSO_HOST_TIMESTAMP_64BIT                  (0)
+
+// Lasso host performance counters:
+// - 1 = registers read-only uint32 array data cell "Perf" (not a default
+//   strobe member), element order see LASSO_PERF_xxx in lasso_host.h:
+//   strobes sampled/skipped, busy retries, Bytes sent per stream, and
+//   cycles (last/max) of strobe sampling and command processing
+// - LASSO_HOST_PERF_CYCLES(): free-running cycle counter read, e.g.
+//   (DWT->CYCCNT) on Cortex-M3/M4 or a user function; (0) if unavailable
+#define LASSO_HOST_PERF_COUNTERS                    (0)
+#define LASSO_HOST_PERF_CYCLES()                    (0)
+
+// Lasso host instances:
+// - 0 = single instance, the lasso_hostXxx() API serves the one host
+// - 1 = additional instances from lasso_hostCreate(), each with its own
+//   dataspace, strobe rate and serial link, served by lasso_hostXxx_r(h, ...);
+//   lasso_hostXxx() keeps serving the default instance
+// - printf() notifications are sent by the default instance
+#define LASSO_HOST_MULTI_INSTANCE                   (0)
+
 // Lasso host tick period:
 // - call period of lasso_hostHandleCOM()
 // - specified in [ms], valid values: >0, <250.0 (advertisement period)
@@ -74,7 +118,7 @@
 
 // Lasso host frame size:
 // - messages are subdivided into frames before transmission
-// - for COBS encoding: frame size = 256
+// - for COBS encoding: frame size = 256 (unless whole-frame COBS, see below)
 // - for RN and ESC encoding: any multiple of 256 (up to 65536)
 // - usually, limit is defined by max. DMA transmission size or RAM limit
 // - on MAX32630FTHR, the limit is 64 Byte due to the USB bulk endpoint
@@ -82,9 +126,23 @@
 
 // Lasso host CRC Byte-width:
 // - width valid for all lasso message types, if enabled further below
-// - valid values: 1, 2, 4 (however, only 2 supported so far)
+// - valid values: 1, 2, 4 (target examples only support 2,
+//   built-in CRC engine supports all: CRC-8, CRC-16-CCITT, CRC-32)
 #define LASSO_HOST_CRC_BYTEWIDTH                    (2)
 
+// Lasso host CRC engine:
+// - LASSO_CRC_USER: CRC callback registered in lasso_hostRegisterCOM()
+// - LASSO_CRC_TABLE: built-in table-driven CRC (crc/crc.c), computed while
+//   sampling data cells, callback in lasso_hostRegisterCOM() may be NULL
+// - either engine can be replaced by an incremental CRC function (e.g. a
+//   hardware CRC unit), see lasso_hostRegisterCRC()
+#define LASSO_HOST_CRC_ENGINE                       LASSO_CRC_USER
+
+// Lasso host CRC table slicing (built-in CRC engine only):
+// - 1, 4 or 8 Bytes per table lookup round
+// - costs 256 table entries of CRC Byte-width per Byte (Flash)
+#define LASSO_HOST_CRC_SLICES                       (4)
+
 // Lasso host serial port baudrate
 // - used internally to calculate response latency
 #define LASSO_HOST_BAUDRATE                         (115200)
@@ -94,11 +152,46 @@
 // - the same setting is applied to outgoing message (response) encoding
 #define LASSO_HOST_COMMAND_ENCODING                 LASSO_ENCODING_RN
 
+// Lasso host COBS wire format (only relevant for COBS encoding)
+// - 1 = legacy: frames are cut in COBS chunks of 253 Bytes (frame size 256)
+// - 0 = standard COBS over entire frames (one transmission per frame size),
+//   requires a Lasso client supporting extended protocol info
+#define LASSO_HOST_COBS_CHUNKED_FRAMES              (1)
+
+// Lasso host ESCS staging window size in [Bytes] (only for ESCS encoding)
+// - 0 = frame buffers are allocated twice for worst case ESCS overhead
+// - >0 = frame buffers hold payload only, frames are encoded in parts into
+//   a window of 2x this size (one half transmitted while other is encoded)
+// - one half is sent per tick: choose >= Bytes per tick on serial line,
+//   e.g. 256 for 115200 baud and 10ms tick, <= LASSO_HOST_MAX_FRAME_SIZE
+#define LASSO_HOST_ESCS_WINDOW_SIZE                 (0)
+
 // Lasso host incoming message (command) buffer size in [Bytes]
 // - min. 16, max. 64 Bytes!
 // - careful when sending string data!
 #define LASSO_HOST_COMMAND_BUFFER_SIZE              (16)
 
+// Lasso host incoming message (command) receive ring size in [Bytes]
+// - 0 = lasso_hostReceiveByte() decodes each Byte as it arrives (e.g. in ISR)
+// - power of two >= 16: lasso_hostReceiveBlock() copies chunks of Bytes
+//   (e.g. from RX DMA or IDLE-line interrupt) into a ring, which is decoded
+//   in lasso_hostHandleCOM(); must hold all Bytes received within one tick
+#define LASSO_HOST_RECEIVE_RING_SIZE                (0)
+
+// Lasso host incoming message (command) queue depth
+// - 1, 2, 4 or 8 command buffers, each of LASSO_HOST_COMMAND_BUFFER_SIZE
+// - with more than 1, the client may send further commands before the
+//   response to the previous one arrived, queued commands are served as
+//   soon as the response frame is free (not only every response latency)
+#define LASSO_HOST_COMMAND_QUEUE                    (1)
+
+// Lasso host incoming message (command) batching
+// - 1 = opcode 'b' runs a GET command over a range of datacells, e.g.
+//   "bp0,32" replies params of datacells 0...31 (one response frame each)
+// - only GET_DATACELL_PARAMS ('p') and GET_DATACELL_VALUE ('v') supported
+// - requires LASSO_ASCII_MODE
+#define LASSO_HOST_COMMAND_BATCH                    (0)
+
 // Lasso host incoming message (command) CRC
 // - for RN encoding: CRC must be disabled
 // - for other encodings: if enabled, CRC generator must be provided by user
@@ -117,10 +210,42 @@
 // Lasso host outgoing message (strobe) dynamics
 // - dynamic strobing allows selection of custom update periods for datacells
 // - strobe size is adjusted dynamically to active set of datacells
+// - delta strobing only sends datacells whose value changed since last sent
+//   (on top of custom update periods), see LASSO_HOST_STROBE_KEYFRAME_PERIOD
 // - STATIC required for strobe encoding "NONE"
-// - either STATIC or DYNAMIC for strobe encoding "ESCS" or "COBS"
+// - either STATIC, DYNAMIC or DELTA for strobe encoding "ESCS" or "COBS"
 #define LASSO_HOST_STROBE_DYNAMICS                  LASSO_STROBE_STATIC
 
+// Lasso host outgoing message (strobe) keyframe period in [strobes]
+// - only relevant for LASSO_STROBE_DELTA or LASSO_HOST_STROBE_COMPRESS
+// - every n-th strobe holds all active datacells (changed or not) to keep
+//   client in sync, also after strobing (re)started or datacell set changed
+// - integer value >= 1 required (1 = no delta compression)
+#define LASSO_HOST_STROBE_KEYFRAME_PERIOD           (100)
+
+// Lasso host outgoing message (strobe) compression
+// - 0: strobe payload sent as sampled
+// - 1: payload XOR'ed with previous strobe, split into byte planes of
+//   LASSO_HOST_STROBE_COMPRESS_STRIDE Bytes and zero run-length coded,
+//   keyframes (raw values) every LASSO_HOST_STROBE_KEYFRAME_PERIOD strobes
+// - only for LASSO_STROBE_STATIC with strobe encoding "ESCS" or "COBS"
+//   (no msgpack strobes, no external strobe source)
+// - reported in bits 9...11 of extended protocol info
+#define LASSO_HOST_STROBE_COMPRESS                  (0)
+
+// Lasso host outgoing message (strobe) compression stride in [Bytes]
+// - only relevant for LASSO_HOST_STROBE_COMPRESS
+// - 1, 2, 4 or 8, typically the dominant datacell byte width
+#define LASSO_HOST_STROBE_COMPRESS_STRIDE           (4)
+
+// Lasso host outgoing message (strobe) rate groups
+// - only relevant for LASSO_STROBE_DYNAMIC or LASSO_STROBE_DELTA
+// - 0: every datacell counts down its own update rate in every strobe
+// - 1: datacells are grouped by update rate at registration, each strobe
+//   only visits the groups that are due (cost scales with due datacells)
+// - update rates are rounded down to the next power of two (1, 2, 4, ...)
+#define LASSO_HOST_STROBE_RATE_GROUPS               (0)
+
 // Lasso host outgoing message (strobe) minimum period in [ticks]
 // - integer value > 0 required
 #define LASSO_HOST_STROBE_PERIOD_MIN_TICKS          (10)
@@ -132,6 +257,21 @@
 // Lasso host outgoing message (strobe) default period in [ticks]
 #define LASSO_HOST_STROBE_PERIOD_TICKS      LASSO_HOST_STROBE_PERIOD_MIN_TICKS
 
+// Lasso host outgoing message (strobe) period autotuning
+// - 1: the time from start of strobe transmission to the final call of
+//   lasso_hostSignalFinishedCOM() is measured in ticks, and the strobe period
+//   is stretched such that the measured link utilization stays below
+//   LASSO_HOST_AUTOTUNE_UTILIZATION [%] (e.g. same firmware on slow UART and
+//   fast USB CDC links without hand-tuning)
+// - the period requested by the Lasso client (or default) is restored as soon
+//   as the link allows it for LASSO_HOST_AUTOTUNE_WINDOW strobes
+// - each change is reported through perCallback (which may modify it), the
+//   Lasso client obtains the current period with the timing info request
+// - not possible with external strobe synchronization
+#define LASSO_HOST_AUTOTUNE                         (0)
+#define LASSO_HOST_AUTOTUNE_UTILIZATION             (80)
+#define LASSO_HOST_AUTOTUNE_WINDOW                  (16)
+
 // Lasso host outgoing message (strobe) trigger synchronization
 // - strobing can be synchronized on external, user-provided event
 #define LASSO_HOST_STROBE_EXTERNAL_SYNC             (0)
@@ -144,6 +284,112 @@
 // - for all encodings: if enabled, CRC generator must be provided by user
 #define LASSO_HOST_STROBE_CRC_ENABLE                (1)
 
+// Lasso host outgoing message (strobe) buffer count
+// - 1 = single buffer, locked while transmitting (strobe dropped if busy)
+// - 2 = ping-pong, next strobe is sampled while previous one is transmitted
+// - up to 8 buffers (ring), each adds one strobe buffer to heap usage
+// - must be 1 for external strobe source
+#define LASSO_HOST_STROBE_BUFFERS                   (1)
+
+// Lasso host outgoing message (strobe) copy plan
+// - 1 = sample strobe from a precompiled, flat list of copy operations
+// - adjacent memory cells of same Byte width are merged into one operation
+// - costs 12 Bytes of heap per registered datacell
+// - STATIC strobe dynamics and internal strobe source required
+#define LASSO_HOST_STROBE_COPY_PLAN                 (0)
+
+// Lasso host outgoing message (strobe) bulk copy threshold in [Bytes]
+// - only relevant if LASSO_HOST_UNALIGNED_MEMORY_ACCESS is 0
+// - memory cells of 2-Byte, 4-Byte or 8-Byte arrays of at least this size
+//   are copied with aligned 32-Bit moves instead of Byte-wise writes
+// - min. 8 Bytes
+#define LASSO_HOST_BULK_COPY_MIN_BYTES              (16)
+
+// Lasso host outgoing message (strobe) user copy threshold in [Bytes]
+// - memory cells of at least this size are handed to a user-supplied
+//   memory-to-memory copy function (e.g. DMA), see lasso_hostRegisterMEMCPY()
+// - 0 = disabled, otherwise choose a size where DMA setup time pays off
+#define LASSO_HOST_MEMCPY_MIN_BYTES                 (0)
+
+// Lasso host outgoing message (strobe) scatter-gather transmission
+// - 1 = strobes are transmitted straight from memory cells (zero-copy),
+//   no strobe buffer is allocated, see lasso_hostRegisterSG()
+// - STATIC strobe dynamics, strobe encoding NONE and no strobe CRC required
+// - memory cells are read by the transmitting DMA, not atomically
+#define LASSO_HOST_STROBE_SCATTER_GATHER            (0)
+
+// Lasso host outgoing message (strobe) aligned layout
+// - 1 = active datacells are laid out widest Byte width first (8, 4, 2, 1),
+//   in registration order within each width, such that every datacell is
+//   naturally aligned relative to the strobe payload (no padding needed)
+// - the strobe payload itself starts on a LASSO_MEMORY_ALIGN boundary in
+//   memory (strobe buffers are offset by up to LASSO_MEMORY_ALIGN - 1 Bytes)
+// - the Byte positions reported by GET_DATACELL_PARAMS follow this layout
+// - host copies merge into fewer, longer word runs, and the client can
+//   decode with aligned loads
+// - copy plan or scatter-gather required
+#define LASSO_HOST_STROBE_ALIGN                     (0)
+
+// Lasso host outgoing message (strobe) msgpack format
+// - 1 = strobe frame is a msgpack array of the active datacells (scalars,
+//   arrays, or raw bytes for char), values are big-endian and typed, so
+//   that the client needs neither the strobe layout nor host endianness
+// - elements use fixed-width codes (e.g. uint8 always 2 Bytes), packed
+//   headers are precomputed in lasso_hostRegisterMEM()
+// - STROBE_ENCODING COBS or ESCS, STATIC strobe dynamics, internal strobe
+//   source, no copy plan and no scatter-gather required
+#define LASSO_HOST_STROBE_MSGPACK                   (0)
+
+// Lasso host capture ring (oscilloscope mode) size in [Bytes]
+// - 0 = no capture mode
+// - otherwise, command 'C' arms the capture: strobes are sampled into this
+//   RAM ring at every tick (regular strobing suspended), a trigger freezes
+//   the ring after the post-trigger samples, and the samples are then sent
+//   as a burst of regular strobe frames
+// - trigger: rising edge of a datacell through a level given with 'C', or
+//   user callback (see lasso_hostRegisterTRIG()), or immediately
+// - capture depth = size / strobe size (active datacells), sent in reply
+// - STATIC strobe dynamics, single strobe buffer, internal strobe source,
+//   no scatter-gather and no strobe compression required
+#define LASSO_HOST_CAPTURE_SIZE                     (0)
+
+// Lasso host strobe snapshot (consistent groups of datacells)
+// - 1 = producers bracket updates of related datacells with
+//   lasso_hostPublishBegin() / lasso_hostPublishEnd() (non-blocking, callable
+//   from ISRs and tasks), the strobe sampler re-copies the datacells if an
+//   update was in progress or completed meanwhile (seqlock)
+// - after LASSO_HOST_SNAPSHOT_RETRIES re-copies, the strobe is sent as is
+//   (a producer updating continuously must not stall strobing)
+// - publishers should be ISRs or tasks of higher priority than the one
+//   calling lasso_hostHandleCOM() (or run on another core)
+// - FreeRTOS: see target/lasso_host_FreeRTOS.c for a Lasso task with queued
+//   command reception
+// - STATIC strobe dynamics, internal strobe source, no scatter-gather and no
+//   msgpack strobes required
+// - requires atomic compare-and-swap, see LASSO_HOST_CAS in lasso_defaults.h
+#define LASSO_HOST_SNAPSHOT                         (0)
+#define LASSO_HOST_SNAPSHOT_RETRIES                 (2)
+
+// Lasso host static dataspace
+// - 1 = datacells are declared as a const table with LASSO_DATACELL() and
+//   registered at once with lasso_hostRegisterDataspace(), instead of
+//   calling lasso_hostRegisterDataCell() for each datacell
+// - the table may reside in flash, only strobe membership (1 bit) and the
+//   update rate countdown (2 Bytes, dynamic strobing) per datacell are in RAM
+// - LASSO_HOST_TIMESTAMP (0) required (timestamp may be declared in table),
+//   no delta strobing, no rate groups, no msgpack strobes and internal
+//   strobe source
+#define LASSO_HOST_DATASPACE_STATIC                 (0)
+
+// Lasso host datacell index
+// - 1 = datacells are looked up in a table instead of walking the list, and
+//   their strobe Byte positions are precomputed
+// - adds opcodes 'h' and 'H' to get/set datacell values by the FNV-1a hash
+//   of the datacell name, so that a client need not re-enumerate the data-
+//   space after a firmware update
+// - costs 16 Bytes of heap per registered datacell
+#define LASSO_HOST_DATACELL_INDEX                   (0)
+
 // Lasso host outgoing message (response) buffer size in [Bytes]
 // - min. 32, max. 256 Bytes
 // - careful when sending string data!
@@ -157,12 +403,41 @@
 // - integer value > 0 required
 #define LASSO_HOST_RESPONSE_LATENCY_TICKS           (5)
 
+// Lasso host controls (R/C mode) fast path, payload size in [Bytes]
+// - 0 = controls frames are handled like commands (response latency applies)
+// - otherwise, a controls frame of exactly this payload size is recognized
+//   and CRC-checked in lasso_hostReceiveByte(), handed to the callback of
+//   lasso_hostRegisterCTRLSISR() right there, and to the callback of
+//   lasso_hostRegisterCTRLS() at the next tick (latest controls win)
+// - e.g. 2 * RADIO_CHANNELS for PXX_setControls() (radio/pxx.c)
+// - COBS or ESCS command encoding required
+// - requires atomic compare-and-swap, see LASSO_HOST_CAS in lasso_defaults.h
+#define LASSO_HOST_CONTROLS_SIZE                    (0)
+
 // Lasso host command and response processing mode
 // - choose between LASSO_ASCII_MODE and LASSO_MSGPACK mode and recall:
 // - ASCII mandatory for RN encoding
 // - any of (ASCII, MSGPACK) for other encodings
 #define LASSO_HOST_PROCESSING_MODE                  LASSO_ASCII_MODE
 
+// Lasso host built-in ASCII number conversion
+// - replaces sscanf()/sprintf() in LASSO_ASCII_MODE with allocation-free
+//   decimal conversion routines (see ascii/ascii.c), no stdio required
+// - integers are parsed as decimal only (no octal/hex prefixes)
+// - 1=enable, 0=disable (use stdio)
+#define LASSO_HOST_ASCII_BUILTIN                    (0)
+
+// Lasso host built-in ASCII float formatting without float arithmetic
+// - decomposes float/double data cells from IEEE-754 bits with integer
+//   arithmetic only (for targets without FPU)
+// - 1=enable, 0=disable
+#define LASSO_HOST_ASCII_FIXED_POINT                (0)
+
+// Lasso host built-in ASCII float decimals
+// - number of decimals printed for float/double data cells (0..9)
+// - 6 matches sprintf("%f")
+#define LASSO_HOST_ASCII_FLOAT_DECIMALS             (6)
+
 // Lasso host enable notifications?
 // - notfications can only be used in full COBS/ESCS mode (cmd/resp/strobe)
 // - adopts same encoding scheme as command/response/strobe
@@ -177,6 +452,38 @@
 
 // Shall provisions for printf() use be made by Lasso host?
 #define LASSO_HOST_NOTIFICATION_USE_PRINTF          (0)
+
+// Lasso host notification queue in [records]
+// - 0 = no queue, lasso_hostLog() not available
+// - otherwise, power of two >= 2: lasso_hostLog() stores a format string
+//   pointer and 3 integer arguments lock-free (callable from ISRs and tasks),
+//   lasso_hostHandleCOM() formats and sends one record whenever the
+//   notification frame is free
+// - format strings must be static (e.g. literals), conversions %d %i %u %x
+//   %X %c %% only, records are dropped (and counted) if the queue is full
+// - requires atomic compare-and-swap, see LASSO_HOST_CAS in lasso_defaults.h
+#define LASSO_HOST_NOTIFICATION_QUEUE               (0)
+
+// Lasso host link scheduler (shares serial line among strobe, response and
+// notification frames):
+// - LASSO_LINK_PRIORITY: strobe first, then response, then notification;
+//   responses and notifications may starve during heavy strobing
+// - LASSO_LINK_WEIGHTED: each pending stream obtains at least its share of
+//   the serial line, the strobe obtains the remainder; shares not used by an
+//   idle stream go to the others
+// - frames are never interleaved: strobe jitter is bounded by the longest
+//   response/notification frame (in ticks of LASSO_HOST_MAX_FRAME_SIZE)
+#define LASSO_HOST_LINK_SCHEDULER                   LASSO_LINK_PRIORITY
+
+// Link shares of responses and notifications in [%] (weighted scheduler)
+// - 1...98 each, sum < 100 (remainder is strobe share)
+#define LASSO_HOST_LINK_SHARE_RESPONSE              (10)
+#define LASSO_HOST_LINK_SHARE_NOTIFICATION          (5)
+
+// Link latency budget in [ticks] (weighted scheduler)
+// - a response or notification pending for longer is sent next, regardless
+//   of its share
+#define LASSO_HOST_LINK_LATENCY_TICKS               (LASSO_HOST_RESPONSE_LATENCY_TICKS)
     
 
 #ifdef __cplusplus
@@ -190,6 +497,14 @@ extern int32_t lasso_comCallback_PSoC5(uint8_t* src, uint32_t cnt);
 #if (LASSO_HOST_STROBE_CRC_ENABLE == 1) || (LASSO_HOST_COMMAND_CRC_ENABLE == 1)
 extern uint32_t lasso_crcCallback_PSoC5(uint8_t* src, uint32_t cnt);
 #endif
+// - example for lasso_host_PSoC6.c (incremental CRC on Crypto block):
+#if (LASSO_HOST_STROBE_CRC_ENABLE == 1) || (LASSO_HOST_COMMAND_CRC_ENABLE == 1)
+extern uint32_t lasso_crcUpdateCallback_PSoC6(uint32_t crc, const uint8_t* src, uint32_t cnt);
+#endif
+// - example for lasso_host_PSoC6.c (memory-to-memory DMA):
+#if (LASSO_HOST_MEMCPY_MIN_BYTES > 0)
+extern int32_t lasso_memcpyCallback_PSoC6(uint8_t* dest, const void* src, uint32_t cnt);
+#endif
 
 #ifdef __cplusplus
 }
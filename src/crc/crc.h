@@ -0,0 +1,72 @@
+/******************************************************************************/
+/*                                                                            */
+/*  \file       crc.h                                                         */
+/*  \date       Oct 2026                                                      */
+/*  \author     Severin Leven                                                 */
+/*                                                                            */
+/*  \brief      Cyclic redundancy check (CRC) library API                     */
+/*                                                                            */
+/*              Table-driven (slicing-by-N) CRC generation.                   */
+/*                                                                            */
+/*  This file is part of the Lasso host library. Lasso is a configurable and  */
+/*  efficient mechanism for data transfer between a host (server) and client. */
+/*                                                                            */
+/*  All public API definitions, typedefs, variables, structs and functions    */
+/*  related to the CRC algorithm are collected here.                          */
+/*                                                                            */
+/******************************************************************************/
+/*                                                                            */
+/*  Target CPU: any 32-bit                                                    */
+/*  Ressources: CPU                                                           */
+/*                                                                            */
+/******************************************************************************/
+
+#ifndef CRC_H
+#define CRC_H
+
+
+//----------//
+// Includes //
+//----------//
+
+#include <stdint.h>     // for int types
+
+
+//----------------------//
+// Public functions API //
+//----------------------//
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*!
+ *  \brief  Continue CRC computation over a number of Bytes.
+ *
+ *          CRC width is LASSO_HOST_CRC_BYTEWIDTH. Start with crc = 0 and
+ *          feed the result of the previous call to continue over further
+ *          Bytes (incremental computation).
+ *
+ *  \return right-aligned 32-bit CRC value
+ */
+uint32_t CRC_update (
+    uint32_t crc,           //!< CRC value over preceding Bytes (0 at start)
+    const uint8_t* src,     //!< source buffer
+    uint32_t cnt            //!< number of Bytes to iterate over
+);
+
+/*!
+ *  \brief  Compute CRC over a buffer (lasso_crcCallback compatible).
+ *
+ *  \return right-aligned 32-bit CRC value
+ */
+uint32_t CRC_compute (
+    uint8_t* src,           //!< source buffer
+    uint32_t cnt            //!< number of Bytes to iterate over
+);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CRC_H */
@@ -47,6 +47,8 @@
 
 #include "encodings/cobs.h"
 
+#include <string.h>     // for memmove()
+
 
 //-----------------//
 // Private defines //
@@ -54,17 +56,65 @@
 
 #define COBS_DEL 0x00       //!< COBS frame start and end delimiter code
 #define COBS_EXT 0xFF       //!< COBS frame delimiter code for extended messages
+#define COBS_RUN 254        //!< max. number of non-zero Bytes per COBS code
+
+// word-at-a-time (SWAR) test for a zero Byte in 32-bit word x
+#define COBS_HASZERO(x)     (((x) - 0x01010101UL) & ~(x) & 0x80808080UL)
 
 
 //-------------------//
 // Private variables //
 //-------------------//
 
-// used for inline COBS decoding only
-static volatile struct {
-    unsigned char code;         //!< latest COBS code (decrementer)
-    unsigned char count;        //!< Bytes read in current frame
-} COBS_ctrl = {255, 255};
+// used for inline COBS decoding only (default serial link)
+static volatile COBS_decoder COBS_ctrl = COBS_DECODER_INIT;
+
+
+//-------------------//
+// Private functions //
+//-------------------//
+
+/*!
+ *  \brief  Find first zero Byte in a buffer, 4 Bytes per step where aligned.
+ *
+ *          Never reads beyond "limit" Bytes (aligned words only).
+ *
+ *  \return index of first zero Byte, or "limit" if none found
+ */
+static uint32_t COBS_scan (
+    const uint8_t* src,     //!< buffer to scan
+    uint32_t limit          //!< max. number of Bytes to scan
+) {
+    uint32_t i = 0;
+    uint32_t w;
+
+    // head: Byte-wise until LongWord-aligned
+    while ((i < limit) && (((uintptr_t)(src + i)) & 3)) {
+        if (src[i] == COBS_DEL) {
+            return i;
+        }
+        i++;
+    }
+
+    // middle: one aligned word per step
+    while (i + 4 <= limit) {
+        w = *(const uint32_t*)(src + i);
+        if (COBS_HASZERO(w)) {
+            break;          // zero Byte in this word, locate below
+        }
+        i += 4;
+    }
+
+    // tail (or word with zero Byte): Byte-wise
+    while (i < limit) {
+        if (src[i] == COBS_DEL) {
+            return i;
+        }
+        i++;
+    }
+
+    return limit;
+}
 
 
 //----------------------//
@@ -83,7 +133,7 @@ static volatile struct {
  *          - 253 payload characters (any value except 0x00)
  *          - end delimiter (0x00)
  *
- *          Uses the internal state struct COBS_ctrl to keep track of
+ *          Uses the decoder state struct d (one per serial link) to keep track of
  *          current COBS code and number of Bytes already decoded.
  *
  *          Payloads longer than destination buffer size are trashed.
@@ -92,52 +142,53 @@ static volatile struct {
  *          sizeof(destination buffer) + 1 if buffer overrun,
  *          0 otherwise
  */
-uint8_t COBS_decode_inline (
-    uint8_t c,      //!< received Byte
-    uint8_t* dest,  //!< destination buffer
-    uint8_t size    //!< size of destination buffer (1...253)
+uint8_t COBS_decode_inline_r (
+    volatile COBS_decoder* d, //!< decoder state
+    uint8_t c,                //!< received Byte
+    uint8_t* dest,            //!< destination buffer
+    uint8_t size              //!< size of destination buffer (1...253)
 ) {
     if (c == COBS_DEL) {            // check for delimiter
-        c = COBS_ctrl.code;
-        COBS_ctrl.code = 255;       // expect first COBS code next
+        c = d->code;
+        d->code = 255;              // expect first COBS code next
 
         if (c == 0) {               // finished valid COBS message
-            c = COBS_ctrl.count;
-            COBS_ctrl.count = 0;    // reset count
+            c = d->count;
+            d->count = 0;           // reset count
             return c;
         }
         else {                      // message invalid, skip
-            COBS_ctrl.count = 0;
+            d->count = 0;
             return 0;
         }
     }
 
-    if (COBS_ctrl.code == 255) {    // first COBS code
-        if (COBS_ctrl.count) {      // no COBS_DEL received previously
+    if (d->code == 255) {           // first COBS code
+        if (d->count) {             // no COBS_DEL received previously
             return 0;
         }
-        COBS_ctrl.code  = c;
+        d->code  = c;
 
         if (c > 1) {
-            COBS_ctrl.code--;
+            d->code--;
             return 0;
         }
 
         c = 0;
     }
     else
-    if (COBS_ctrl.code == 0) {      // subsequent COBS code
-        COBS_ctrl.code = c;
+    if (d->code == 0) {             // subsequent COBS code
+        d->code = c;
         c = 0;
     }
 
-    COBS_ctrl.code--;
+    d->code--;
 
-    if (COBS_ctrl.count < size) {   // as long as destination fits
-        dest[COBS_ctrl.count++] = c;
+    if (d->count < size) {          // as long as destination fits
+        dest[d->count++] = c;
     }
     else {
-        COBS_ctrl.code = 255;       // otherwise trash message
+        d->code = 255;              // otherwise trash message
         return size + 1;            // return invalid size
     }
 
@@ -145,6 +196,22 @@ uint8_t COBS_decode_inline (
 }
 
 
+/*!
+ *  \brief  Decode a COBS-encoded message as Bytes are read in (default link).
+ *
+ *          See COBS_decode_inline_r(), uses the internal state struct COBS_ctrl.
+ *
+ *  \return See COBS_decode_inline_r()
+ */
+uint8_t COBS_decode_inline (
+    uint8_t c,                //!< received Byte
+    uint8_t* dest,            //!< destination buffer
+    uint8_t size              //!< size of destination buffer
+) {
+    return COBS_decode_inline_r(&COBS_ctrl, c, dest, size);
+}
+
+
 /*!
  *   COBS encoding of payload data provided in a COBS buffer.
  *
@@ -192,4 +259,61 @@ void COBS_encode (
     if (extended) {
         *srca = COBS_EXT;
     }
-}
\ No newline at end of file
+}
+
+
+/*!
+ *   COBS encoding of an entire frame in one pass (no 253 Byte chunks).
+ *
+ *   Standard COBS: code 0xFF denotes 254 non-zero Bytes NOT followed by
+ *   a zero, such that frames of any length are encoded without restart.
+ *   The encoded frame is enclosed in COBS delimiters (0x00), i.e. the
+ *   overhead is COBS_HEADER_SIZE(size) + 1 Bytes at most.
+ *
+ *   Encoding can be performed in place: if payload data is placed at
+ *   offset COBS_HEADER_SIZE(size) of a buffer, it can be encoded to the
+ *   start of that same buffer (dest == buffer, src == buffer + offset).
+ *   Zero Bytes are searched 4 Bytes at a time (see COBS_scan()).
+ *
+ *   \return    number of encoded Bytes including both delimiters
+ */
+uint32_t COBS_encode_frame (
+    uint8_t* dest,          //!< destination buffer
+    const uint8_t* src,     //!< payload data
+    uint32_t size           //!< number of payload Bytes
+) {
+    uint8_t* start = dest;
+    uint8_t* code;
+    uint32_t run;
+
+    *dest++ = COBS_DEL;         // write initial COBS delimiter
+
+    while (1) {
+        code = dest++;          // reserve COBS code
+        run = COBS_scan(src, (size < COBS_RUN) ? size : COBS_RUN);
+
+        memmove(dest, src, run);// may overlap when encoding in place
+        dest += run;
+        src  += run;
+        size -= run;
+
+        if (run == COBS_RUN) {
+            *code = COBS_EXT;   // 254 Bytes, no implicit zero
+            if (size == 0) {
+                break;
+            }
+        }
+        else {
+            *code = (uint8_t)(run + 1);
+            if (size == 0) {
+                break;
+            }
+            src++;              // skip zero Byte (implicit in code)
+            size--;
+        }
+    }
+
+    *dest++ = COBS_DEL;         // write final COBS delimiter
+
+    return (uint32_t)(dest - start);
+}
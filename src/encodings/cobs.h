@@ -42,6 +42,23 @@ typedef struct {
     uint8_t body;       //!< placeholder: message body can be of any size
 } COBS_buf;
 
+typedef struct {
+    unsigned char code;         //!< latest COBS code (decrementer)
+    unsigned char count;        //!< Bytes read in current frame
+} COBS_decoder;
+
+
+//----------------//
+// Public defines //
+//----------------//
+
+// Bytes to reserve in front of n payload Bytes for in-place COBS_encode_frame()
+// (initial delimiter plus one COBS code per 254 Bytes started)
+#define COBS_HEADER_SIZE(n)     (2 + (n) / 254)
+
+// initial state of a COBS_decoder (no frame started)
+#define COBS_DECODER_INIT       {255, 255}
+
 
 //----------------------//
 // Public functions API //
@@ -64,6 +81,19 @@ uint8_t COBS_decode_inline (
     uint8_t size              //!< size of destination buffer
 );
 
+/*!
+ *  \brief  Decode a COBS message as Bytes are read in, using the state
+ *          of decoder d (one decoder per serial link).
+ *
+ *  \return size of message once fully received, 0 otherwise
+ */
+uint8_t COBS_decode_inline_r (
+    volatile COBS_decoder* d, //!< decoder state
+    uint8_t c,                //!< received Byte
+    uint8_t* dest,            //!< destination buffer
+    uint8_t size              //!< size of destination buffer
+);
+
 /*!
  *  \brief  Encode up to 253 payload Bytes using COBS algorithm.
  *
@@ -75,6 +105,17 @@ void COBS_encode (
     bool extended           //!< frame part of extended message?
 );
 
+/*!
+ *  \brief  Encode an entire frame using standard COBS algorithm.
+ *
+ *  \return Number of encoded Bytes (including delimiters)
+ */
+uint32_t COBS_encode_frame (
+    uint8_t* dest,          //!< destination buffer
+    const uint8_t* src,     //!< payload data
+    uint32_t size           //!< number of payload Bytes
+);
+
 #ifdef __cplusplus
 }
 #endif
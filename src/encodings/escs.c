@@ -41,6 +41,8 @@
 
 #include "encodings/escs.h"
 
+#include <string.h>     // for memcpy()
+
 
 //-----------------//
 // Private defines //
@@ -49,16 +51,65 @@
 #define ESCS_ESC 0x7D       //!< ECSS escape sequence character
 #define ESCS_DEL 0x7E       //!< ESCS frame start and end delimiter code
 
+// word-at-a-time (SWAR) test for a Byte in range 0x7C...0x7F in 32-bit word x
+// (superset of ESCS_ESC and ESCS_DEL, candidates are verified Byte-wise)
+#define ESCS_MASKED(x)      (((x) ^ 0x7C7C7C7CUL) & 0xFCFCFCFCUL)
+#define ESCS_HASCAND(x)     ((ESCS_MASKED(x) - 0x01010101UL) & ~ESCS_MASKED(x) & 0x80808080UL)
+
 
 //-------------------//
 // Private variables //
 //-------------------//
 
-// used for inline ESCS decoding only
-static volatile struct {
-    unsigned char state;        //!< ESCS decoding state
-    unsigned char count;        //!< Bytes read in current frame
-} ESCS_ctrl = {0, 0};
+// used for inline ESCS decoding only (default serial link)
+static volatile ESCS_decoder ESCS_ctrl = ESCS_DECODER_INIT;
+
+
+//-------------------//
+// Private functions //
+//-------------------//
+
+/*!
+ *  \brief  Find first Byte to be escaped, 4 Bytes per step where aligned.
+ *
+ *          Never reads beyond "limit" Bytes (aligned words only).
+ *
+ *  \return index of first ESCS_ESC or ESCS_DEL Byte, or "limit" if none found
+ */
+static uint32_t ESCS_scan (
+    const uint8_t* src,     //!< buffer to scan
+    uint32_t limit          //!< max. number of Bytes to scan
+) {
+    uint32_t i = 0;
+    uint32_t w;
+
+    // head: Byte-wise until LongWord-aligned
+    while ((i < limit) && (((uintptr_t)(src + i)) & 3)) {
+        if ((src[i] == ESCS_DEL) || (src[i] == ESCS_ESC)) {
+            return i;
+        }
+        i++;
+    }
+
+    // middle: one aligned word per step
+    while (i + 4 <= limit) {
+        w = *(const uint32_t*)(src + i);
+        if (ESCS_HASCAND(w)) {
+            break;          // candidate Byte in this word, verify below
+        }
+        i += 4;
+    }
+
+    // tail (or word with candidate Byte): Byte-wise
+    while (i < limit) {
+        if ((src[i] == ESCS_DEL) || (src[i] == ESCS_ESC)) {
+            return i;
+        }
+        i++;
+    }
+
+    return limit;
+}
 
 
 //----------------------//
@@ -66,12 +117,12 @@ static volatile struct {
 //----------------------//
 
 /*!
- *  \brief  Decode a ESCS-encoded message as Bytes are read in.
+ *  \brief  Decode an ESCS-encoded message as Bytes are read in.
  *
  *          Reads in a maximum of 254 payload Bytes (single frame).
  *          No support for extended (multiple successive) frames.
  *
- *          Uses the internal state struct ESCS_ctrl to keep track of
+ *          Uses the decoder state struct d (one per serial link) to keep track of
  *          current ESCS state and number of Bytes already decoded.
  *
  *          Payloads longer than destination buffer size are trashed.
@@ -80,17 +131,18 @@ static volatile struct {
  *          sizeof(destination buffer) + 1 if buffer overrun,
  *          0 otherwise
  */
-uint8_t ESCS_decode_inline (
+uint8_t ESCS_decode_inline_r (
+    volatile ESCS_decoder* d, //!< decoder state
     uint8_t c,                //!< received Byte
     uint8_t* dest,            //!< destination buffer
     uint8_t size              //!< size of destination buffer (1...254)
 ) {
     if (c == ESCS_DEL) {            // check for delimiter
-        ESCS_ctrl.state = 255;      // expect message payload now
+        d->state = 255;             // expect message payload now
 
-        if (ESCS_ctrl.count) {      // finished valid ESCS message
-            c = ESCS_ctrl.count;
-            ESCS_ctrl.count = 0;    // reset count
+        if (d->count) {             // finished valid ESCS message
+            c = d->count;
+            d->count = 0;           // reset count
             return c;
         }
         else {                      // zero length message, skip
@@ -99,21 +151,21 @@ uint8_t ESCS_decode_inline (
     }
 
     if (c == ESCS_ESC) {            // check for escape char
-        ESCS_ctrl.state = ESCS_ESC;
+        d->state = ESCS_ESC;
         return 0;
     }
 
-    if (ESCS_ctrl.state) {
-        if (ESCS_ctrl.state == ESCS_ESC) {
-            ESCS_ctrl.state = 255;
+    if (d->state) {
+        if (d->state == ESCS_ESC) {
+            d->state = 255;
             c += 0x20;
         }
 
-        if (ESCS_ctrl.count < size) {   // as long as destination fits
-            dest[ESCS_ctrl.count++] = c;
+        if (d->count < size) {          // as long as destination fits
+            dest[d->count++] = c;
         }
         else {
-            ESCS_ctrl.state = 0;        // otherwise trash message
+            d->state = 0;               // otherwise trash message
             return size + 1;            // return invalid size
         }
     }
@@ -122,6 +174,22 @@ uint8_t ESCS_decode_inline (
 }
 
 
+/*!
+ *  \brief  Decode an ESCS-encoded message as Bytes are read in (default link).
+ *
+ *          See ESCS_decode_inline_r(), uses the internal state struct ESCS_ctrl.
+ *
+ *  \return See ESCS_decode_inline_r()
+ */
+uint8_t ESCS_decode_inline (
+    uint8_t c,                //!< received Byte
+    uint8_t* dest,            //!< destination buffer
+    uint8_t size              //!< size of destination buffer
+) {
+    return ESCS_decode_inline_r(&ESCS_ctrl, c, dest, size);
+}
+
+
 /*!
  *   ESCS encoding of payload data provided in a source buffer.
  *
@@ -141,22 +209,88 @@ uint32_t ESCS_encode (
     uint32_t size       //!< number of payload Bytes
 ) {
     uint8_t* dest_start = dest;
-    uint8_t c;
+    uint32_t run;
 
     *dest++ = ESCS_DEL;
 
-    while (size--) {
-        c = *src++;
+    while (size) {
+        // copy run of Bytes that need no escaping in one go
+        run = ESCS_scan(src, size);
+        memcpy(dest, src, run);
+        dest += run;
+        src  += run;
+        size -= run;
 
-        if ((c == ESCS_DEL) || (c == ESCS_ESC)) {
+        if (size) {
             *dest++ = ESCS_ESC;
-            c -= 0x20;
+            *dest++ = *src++ - 0x20;
+            size--;
         }
-
-        *dest++ = c;
     }
 
     *dest++ = ESCS_DEL;
 
     return (uint32_t)(dest - dest_start);
-}
\ No newline at end of file
+}
+
+
+/*!
+ *   ESCS encoding of payload data in parts, into a destination window.
+ *
+ *   Encodes as many payload Bytes as fit into "space" Bytes of the
+ *   destination window and advances source pointer and remaining size
+ *   accordingly. The start delimiter is written if "first" is set. The
+ *   end delimiter is written as soon as all payload Bytes have been
+ *   encoded, i.e. the frame is complete when "size" has become 0.
+ *   One Byte of the window is always kept in reserve for the end
+ *   delimiter. Must be called with space >= 3.
+ *
+ *   \return    Number of Bytes in destination window
+ */
+uint32_t ESCS_encode_part (
+    uint8_t** src,      //!< source buffer pointer (advanced)
+    uint32_t* size,     //!< number of remaining payload Bytes (decremented)
+    uint8_t* dest,      //!< destination window
+    uint32_t space,     //!< size of destination window (>= 3)
+    bool first          //!< start of frame (write start delimiter)?
+) {
+    uint8_t* dest_start = dest;
+    uint8_t* s = *src;
+    uint32_t n = *size;
+    uint32_t run;
+
+    if (first) {
+        *dest++ = ESCS_DEL;
+        space--;
+    }
+
+    while ((n) && (space > 1)) {
+        // copy run of Bytes that need no escaping, keep 1 Byte in reserve
+        run = ESCS_scan(s, (n < space - 1) ? n : space - 1);
+        memcpy(dest, s, run);
+        dest  += run;
+        s     += run;
+        n     -= run;
+        space -= run;
+
+        if ((n == 0) || (space < 3)) {
+            break;      // done, or no space for escape sequence and reserve
+        }
+
+        if ((*s == ESCS_DEL) || (*s == ESCS_ESC)) {
+            *dest++ = ESCS_ESC;
+            *dest++ = *s++ - 0x20;
+            n--;
+            space -= 2;
+        }
+    }
+
+    if (n == 0) {
+        *dest++ = ESCS_DEL;
+    }
+
+    *src  = s;
+    *size = n;
+
+    return (uint32_t)(dest - dest_start);
+}
@@ -33,6 +33,24 @@
 #include <stdbool.h>    // for bool type
 
 
+//-----------------//
+// Public typedefs //
+//-----------------//
+
+typedef struct {
+    unsigned char state;        //!< ESCS decoding state
+    unsigned char count;        //!< Bytes read in current frame
+} ESCS_decoder;
+
+
+//----------------//
+// Public defines //
+//----------------//
+
+// initial state of an ESCS_decoder (waiting for delimiter)
+#define ESCS_DECODER_INIT       {0, 0}
+
+
 //----------------------//
 // Public functions API //
 //----------------------//
@@ -54,6 +72,19 @@ uint8_t ESCS_decode_inline (
     uint8_t size              //!< size of destination buffer
 );
 
+/*!
+ *  \brief  Decode an ESCS message as Bytes are read in, using the state
+ *          of decoder d (one decoder per serial link).
+ *
+ *  \return Size (<=254) of message once fully received, 0 otherwise
+ */
+uint8_t ESCS_decode_inline_r (
+    volatile ESCS_decoder* d, //!< decoder state
+    uint8_t c,                //!< received Byte
+    uint8_t* dest,            //!< destination buffer
+    uint8_t size              //!< size of destination buffer
+);
+
 /*!
  *  \brief  Encode payload frame using ESCS algorithm.
  *
@@ -65,6 +96,19 @@ uint32_t ESCS_encode (
     uint32_t size           //!< number of payload Bytes
 );
 
+/*!
+ *  \brief  Encode part of a payload frame into a window using ESCS algorithm.
+ *
+ *  \return Number of Bytes in destination window
+ */
+uint32_t ESCS_encode_part (
+    uint8_t** src,          //!< source buffer pointer (advanced)
+    uint32_t* size,         //!< number of remaining payload Bytes (decremented)
+    uint8_t* dest,          //!< destination window
+    uint32_t space,         //!< size of destination window (>= 3)
+    bool first              //!< start of frame (write start delimiter)?
+);
+
 #ifdef __cplusplus
 }
 #endif
@@ -48,12 +48,72 @@
     #endif    
 #endif
 
-#if (LASSO_HOST_STROBE_DYNAMICS == LASSO_STROBE_DYNAMIC)
+#if (LASSO_HOST_STROBE_DYNAMICS != LASSO_STROBE_STATIC)
     #if (LASSO_HOST_STROBE_ENCODING == LASSO_ENCODING_NONE)
         #error LASSO_HOST_STROBE_ENCODING must not be NONE when selecting dynamic strobing
     #endif
 #endif
 
+#if (LASSO_HOST_STROBE_DYNAMICS == LASSO_STROBE_DELTA)
+    #if (LASSO_HOST_STROBE_EXTERNAL_SOURCE != 0)
+        #error LASSO_STROBE_DELTA cannot be used with an external strobe source
+    #endif
+#endif
+
+// Lasso host delta strobing: strobes between keyframes (all cells sent)
+#ifndef LASSO_HOST_STROBE_KEYFRAME_PERIOD
+    #define LASSO_HOST_STROBE_KEYFRAME_PERIOD  (100)
+#else
+    #if (LASSO_HOST_STROBE_KEYFRAME_PERIOD < 1)
+        #error Minimum for LASSO_HOST_STROBE_KEYFRAME_PERIOD is 1
+    #endif
+    #if (LASSO_HOST_STROBE_KEYFRAME_PERIOD > 65535)
+        #error Maximum for LASSO_HOST_STROBE_KEYFRAME_PERIOD is 65535
+    #endif
+#endif
+
+// Lasso host multi-rate strobing: cells grouped by power-of-two update rate
+#ifndef LASSO_HOST_STROBE_RATE_GROUPS
+    #define LASSO_HOST_STROBE_RATE_GROUPS   (0)
+#else
+    #if (LASSO_HOST_STROBE_RATE_GROUPS == 1)
+        #if (LASSO_HOST_STROBE_DYNAMICS == LASSO_STROBE_STATIC)
+            #error LASSO_HOST_STROBE_RATE_GROUPS requires dynamic or delta strobing
+        #endif
+        #if (LASSO_HOST_STROBE_EXTERNAL_SOURCE != 0)
+            #error LASSO_HOST_STROBE_RATE_GROUPS cannot be used with an external strobe source
+        #endif
+    #endif
+#endif
+#define LASSO_RATE_GROUPS   (16)    //!< one group per power of two of 16-bit rate
+
+// Lasso host datacell index (lookup by registration order and by name hash)
+#ifndef LASSO_HOST_DATACELL_INDEX
+    #define LASSO_HOST_DATACELL_INDEX       (0)
+#endif
+
+// COBS wire format (1 = legacy chunks of 253 Bytes, 0 = whole frames)
+#ifndef LASSO_HOST_COBS_CHUNKED_FRAMES
+    #define LASSO_HOST_COBS_CHUNKED_FRAMES (1)
+#endif
+
+// ESCS staging window size (0 = frame buffers sized for 2x worst case)
+#ifndef LASSO_HOST_ESCS_WINDOW_SIZE
+    #define LASSO_HOST_ESCS_WINDOW_SIZE (0)
+#else
+    #if (LASSO_HOST_ESCS_WINDOW_SIZE > 0)
+        #if (LASSO_HOST_COMMAND_ENCODING != LASSO_ENCODING_ESCS)
+            #error LASSO_HOST_ESCS_WINDOW_SIZE requires ESCS encoding
+        #endif
+        #if (LASSO_HOST_ESCS_WINDOW_SIZE < 16)
+            #error Minimum for LASSO_HOST_ESCS_WINDOW_SIZE is 16
+        #endif
+        #if (LASSO_HOST_ESCS_WINDOW_SIZE > LASSO_HOST_MAX_FRAME_SIZE)
+            #error LASSO_HOST_ESCS_WINDOW_SIZE must be <= LASSO_HOST_MAX_FRAME_SIZE
+        #endif
+    #endif
+#endif
+
 #ifndef LASSO_HOST_NOTIFICATIONS
     #define LASSO_HOST_NOTIFICATIONS (0)
 #endif
@@ -71,6 +131,36 @@
     #define LASSO_HOST_NOTIFICATION_USE_PRINTF (0)
 #endif
 
+// Lasso host notification queue (deferred formatting log records)
+#ifndef LASSO_HOST_NOTIFICATION_QUEUE
+    #define LASSO_HOST_NOTIFICATION_QUEUE      (0)
+#else
+    #if (LASSO_HOST_NOTIFICATION_QUEUE > 0)
+        #if (LASSO_HOST_NOTIFICATIONS == 0)
+            #error LASSO_HOST_NOTIFICATION_QUEUE requires LASSO_HOST_NOTIFICATIONS
+        #endif
+        #if (LASSO_HOST_NOTIFICATION_QUEUE < 2)
+            #error Minimum for LASSO_HOST_NOTIFICATION_QUEUE is 2
+        #endif
+        #if (LASSO_HOST_NOTIFICATION_QUEUE & (LASSO_HOST_NOTIFICATION_QUEUE - 1))
+            #error LASSO_HOST_NOTIFICATION_QUEUE must be a power of two
+        #endif
+    #endif
+#endif
+
+// Lasso host CRC engine (user callback or built-in table-driven CRC)
+#ifndef LASSO_HOST_CRC_ENGINE
+    #define LASSO_HOST_CRC_ENGINE       LASSO_CRC_USER
+#endif
+
+#ifndef LASSO_HOST_CRC_SLICES
+    #define LASSO_HOST_CRC_SLICES       (4)
+#else
+    #if (LASSO_HOST_CRC_SLICES != 1) && (LASSO_HOST_CRC_SLICES != 4) && (LASSO_HOST_CRC_SLICES != 8)
+        #error LASSO_HOST_CRC_SLICES must be 1, 4 or 8
+    #endif
+#endif
+
 // Lasso host memory alignment policy
 #ifndef LASSO_MEMORY_ALIGN
     #define LASSO_MEMORY_ALIGN          (4)         //<! Byte boundary alignment
@@ -88,6 +178,68 @@
     #endif
 #endif
 
+// Lasso host instances (0 = single instance, 1 = lasso_hostCreate() enabled)
+#ifndef LASSO_HOST_MULTI_INSTANCE
+    #define LASSO_HOST_MULTI_INSTANCE           (0)
+#endif
+
+// Lasso host receive ring size (0 = Bytes decoded in lasso_hostReceiveByte())
+#ifndef LASSO_HOST_RECEIVE_RING_SIZE
+    #define LASSO_HOST_RECEIVE_RING_SIZE        (0)
+#else
+    #if (LASSO_HOST_RECEIVE_RING_SIZE > 0)
+        #if (LASSO_HOST_RECEIVE_RING_SIZE < 16)
+            #error Minimum for LASSO_HOST_RECEIVE_RING_SIZE is 16
+        #endif
+        #if (LASSO_HOST_RECEIVE_RING_SIZE & (LASSO_HOST_RECEIVE_RING_SIZE - 1))
+            #error LASSO_HOST_RECEIVE_RING_SIZE must be a power of two
+        #endif
+    #endif
+#endif
+
+// Lasso host command queue depth (commands in flight)
+#ifndef LASSO_HOST_COMMAND_QUEUE
+    #define LASSO_HOST_COMMAND_QUEUE            (1)
+#else
+    #if (LASSO_HOST_COMMAND_QUEUE != 1) && (LASSO_HOST_COMMAND_QUEUE != 2) && \
+        (LASSO_HOST_COMMAND_QUEUE != 4) && (LASSO_HOST_COMMAND_QUEUE != 8)
+        #error LASSO_HOST_COMMAND_QUEUE must be 1, 2, 4 or 8
+    #endif
+#endif
+
+// Lasso host batched commands (opcode 'b')
+#ifndef LASSO_HOST_COMMAND_BATCH
+    #define LASSO_HOST_COMMAND_BATCH            (0)
+#else
+    #if (LASSO_HOST_COMMAND_BATCH == 1) && (LASSO_HOST_PROCESSING_MODE != LASSO_ASCII_MODE)
+        #error LASSO_HOST_COMMAND_BATCH requires LASSO_ASCII_MODE
+    #endif
+#endif
+
+// Lasso host built-in ASCII number conversion (replaces sscanf/sprintf)
+#ifndef LASSO_HOST_ASCII_BUILTIN
+    #define LASSO_HOST_ASCII_BUILTIN            (0)
+#else
+    #if (LASSO_HOST_ASCII_BUILTIN == 1) && (LASSO_HOST_PROCESSING_MODE != LASSO_ASCII_MODE)
+        #error LASSO_HOST_ASCII_BUILTIN requires LASSO_ASCII_MODE
+    #endif
+#endif
+
+#ifndef LASSO_HOST_ASCII_FIXED_POINT
+    #define LASSO_HOST_ASCII_FIXED_POINT        (0)
+#endif
+
+#ifndef LASSO_HOST_ASCII_FLOAT_DECIMALS
+    #define LASSO_HOST_ASCII_FLOAT_DECIMALS     (6)
+#else
+    #if (LASSO_HOST_ASCII_FLOAT_DECIMALS < 0)
+        #error Minimum for LASSO_HOST_ASCII_FLOAT_DECIMALS is 0
+    #endif
+    #if (LASSO_HOST_ASCII_FLOAT_DECIMALS > 9)
+        #error Maximum for LASSO_HOST_ASCII_FLOAT_DECIMALS is 9
+    #endif
+#endif
+
 #ifndef LASSO_HOST_RESPONSE_BUFFER_SIZE
     #define LASSO_HOST_RESPONSE_BUFFER_SIZE     (96)
 #else
@@ -141,6 +293,271 @@
     #endif
 #endif
 
+// Lasso host strobe period autotuning (measured link utilization)
+#ifndef LASSO_HOST_AUTOTUNE
+    #define LASSO_HOST_AUTOTUNE                 (0)
+#endif
+
+#if (LASSO_HOST_AUTOTUNE == 1)
+    #if (LASSO_HOST_STROBE_EXTERNAL_SYNC != 0)
+        #error LASSO_HOST_AUTOTUNE cannot be used with LASSO_HOST_STROBE_EXTERNAL_SYNC
+    #endif
+    #ifndef LASSO_HOST_AUTOTUNE_UTILIZATION
+        #define LASSO_HOST_AUTOTUNE_UTILIZATION (80)
+    #elif (LASSO_HOST_AUTOTUNE_UTILIZATION < 10) || (LASSO_HOST_AUTOTUNE_UTILIZATION > 100)
+        #error LASSO_HOST_AUTOTUNE_UTILIZATION must be within 10...100
+    #endif
+    #ifndef LASSO_HOST_AUTOTUNE_WINDOW
+        #define LASSO_HOST_AUTOTUNE_WINDOW      (16)
+    #elif (LASSO_HOST_AUTOTUNE_WINDOW < 1) || (LASSO_HOST_AUTOTUNE_WINDOW > 255)
+        #error LASSO_HOST_AUTOTUNE_WINDOW must be within 1...255
+    #endif
+#endif
+
+// Lasso host strobe buffer ring (1 = single buffer, 2 = ping-pong, ...)
+#ifndef LASSO_HOST_STROBE_BUFFERS
+    #define LASSO_HOST_STROBE_BUFFERS           (1)
+#else
+    #if (LASSO_HOST_STROBE_BUFFERS < 1)
+        #error Minimum for LASSO_HOST_STROBE_BUFFERS is 1
+    #endif
+    #if (LASSO_HOST_STROBE_BUFFERS > 8)
+        #error Maximum for LASSO_HOST_STROBE_BUFFERS is 8
+    #endif
+    #if (LASSO_HOST_STROBE_BUFFERS > 1) && (LASSO_HOST_STROBE_EXTERNAL_SOURCE != 0)
+        #error LASSO_HOST_STROBE_BUFFERS must be 1 when using an external strobe source
+    #endif
+#endif
+
+// Lasso host strobe copy plan (flat list of merged copy operations)
+#ifndef LASSO_HOST_STROBE_COPY_PLAN
+    #define LASSO_HOST_STROBE_COPY_PLAN         (0)
+#else
+    #if (LASSO_HOST_STROBE_COPY_PLAN == 1)
+        #if (LASSO_HOST_STROBE_DYNAMICS != LASSO_STROBE_STATIC)
+            #error LASSO_HOST_STROBE_COPY_PLAN requires static strobing
+        #endif
+        #if (LASSO_HOST_STROBE_EXTERNAL_SOURCE != 0)
+            #error LASSO_HOST_STROBE_COPY_PLAN cannot be used with an external strobe source
+        #endif
+    #endif
+#endif
+
+// Lasso host strobe sampling: min. memory cell size for 32-bit word copies
+#ifndef LASSO_HOST_BULK_COPY_MIN_BYTES
+    #define LASSO_HOST_BULK_COPY_MIN_BYTES      (16)
+#else
+    #if (LASSO_HOST_BULK_COPY_MIN_BYTES < 8)
+        #error Minimum for LASSO_HOST_BULK_COPY_MIN_BYTES is 8
+    #endif
+#endif
+
+// Lasso host strobe sampling: min. memory cell size for user copy (0 = off)
+#ifndef LASSO_HOST_MEMCPY_MIN_BYTES
+    #define LASSO_HOST_MEMCPY_MIN_BYTES         (0)
+#else
+    #if (LASSO_HOST_MEMCPY_MIN_BYTES > 0) && (LASSO_HOST_STROBE_EXTERNAL_SOURCE != 0)
+        #error LASSO_HOST_MEMCPY_MIN_BYTES must be 0 when using an external strobe source
+    #endif
+#endif
+
+// Lasso host strobe scatter-gather transmission (no strobe buffer)
+#ifndef LASSO_HOST_STROBE_SCATTER_GATHER
+    #define LASSO_HOST_STROBE_SCATTER_GATHER    (0)
+#else
+    #if (LASSO_HOST_STROBE_SCATTER_GATHER == 1)
+        #if (LASSO_HOST_STROBE_ENCODING != LASSO_ENCODING_NONE)
+            #error LASSO_HOST_STROBE_SCATTER_GATHER requires LASSO_HOST_STROBE_ENCODING to be NONE
+        #endif
+        #if (LASSO_HOST_STROBE_DYNAMICS != LASSO_STROBE_STATIC)
+            #error LASSO_HOST_STROBE_SCATTER_GATHER requires static strobing
+        #endif
+        #if (LASSO_HOST_STROBE_CRC_ENABLE != 0)
+            #error LASSO_HOST_STROBE_SCATTER_GATHER requires LASSO_HOST_STROBE_CRC_ENABLE to be 0
+        #endif
+        #if (LASSO_HOST_STROBE_EXTERNAL_SOURCE != 0)
+            #error LASSO_HOST_STROBE_SCATTER_GATHER cannot be used with an external strobe source
+        #endif
+        #if (LASSO_HOST_STROBE_BUFFERS > 1) || (LASSO_HOST_STROBE_COPY_PLAN == 1)
+            #error LASSO_HOST_STROBE_SCATTER_GATHER does not sample strobes (no buffers, no copy plan)
+        #endif
+    #endif
+#endif
+
+// Lasso host strobe layout: widest Byte width first, naturally aligned cells
+#ifndef LASSO_HOST_STROBE_ALIGN
+    #define LASSO_HOST_STROBE_ALIGN             (0)
+#else
+    #if (LASSO_HOST_STROBE_ALIGN == 1)
+        #if (LASSO_HOST_STROBE_COPY_PLAN == 0) && (LASSO_HOST_STROBE_SCATTER_GATHER == 0)
+            #error LASSO_HOST_STROBE_ALIGN requires a copy plan or scatter-gather
+        #endif
+    #elif (LASSO_HOST_STROBE_ALIGN != 0)
+        #error LASSO_HOST_STROBE_ALIGN must be 0 or 1
+    #endif
+#endif
+
+// Lasso host msgpack strobes (self-describing, big-endian strobe data)
+#ifndef LASSO_HOST_STROBE_MSGPACK
+    #define LASSO_HOST_STROBE_MSGPACK           (0)
+#else
+    #if (LASSO_HOST_STROBE_MSGPACK == 1)
+        #if (LASSO_HOST_STROBE_ENCODING != LASSO_ENCODING_COBS) && \
+            (LASSO_HOST_STROBE_ENCODING != LASSO_ENCODING_ESCS)
+            #error LASSO_HOST_STROBE_MSGPACK requires LASSO_HOST_STROBE_ENCODING to be COBS or ESCS
+        #endif
+        #if (LASSO_HOST_STROBE_DYNAMICS != LASSO_STROBE_STATIC)
+            #error LASSO_HOST_STROBE_MSGPACK requires static strobing
+        #endif
+        #if (LASSO_HOST_STROBE_EXTERNAL_SOURCE != 0)
+            #error LASSO_HOST_STROBE_MSGPACK cannot be used with an external strobe source
+        #endif
+        #if (LASSO_HOST_STROBE_COPY_PLAN == 1) || (LASSO_HOST_STROBE_SCATTER_GATHER == 1)
+            #error LASSO_HOST_STROBE_MSGPACK cannot be used with a copy plan or scatter-gather
+        #endif
+    #endif
+#endif
+
+// Lasso host timestamp from hardware timer (0 = tick counter) and width
+#ifndef LASSO_HOST_TIMESTAMP_TIMER
+    #define LASSO_HOST_TIMESTAMP_TIMER          (0)
+#else
+    #if (LASSO_HOST_TIMESTAMP_TIMER == 1) && (LASSO_HOST_TIMESTAMP == 0)
+        #error LASSO_HOST_TIMESTAMP_TIMER requires LASSO_HOST_TIMESTAMP
+    #endif
+#endif
+
+#if (LASSO_HOST_TIMESTAMP_TIMER == 1)
+    #ifndef LASSO_HOST_TIMESTAMP_UNIT
+        #define LASSO_HOST_TIMESTAMP_UNIT       "us"
+    #endif
+#endif
+
+#ifndef LASSO_HOST_TIMESTAMP_64BIT
+    #define LASSO_HOST_TIMESTAMP_64BIT          (0)
+#endif
+
+// Lasso host performance counters ("Perf" data cell) and cycle counter
+#ifndef LASSO_HOST_PERF_COUNTERS
+    #define LASSO_HOST_PERF_COUNTERS            (0)
+#endif
+
+#if (LASSO_HOST_PERF_COUNTERS == 1)
+    #ifndef LASSO_HOST_PERF_CYCLES
+        #define LASSO_HOST_PERF_CYCLES()        (0)     //<! no cycle measurement
+    #endif
+#endif
+
+// Lasso host strobe compression (XOR-delta, byte planes, zero run-length)
+#ifndef LASSO_HOST_STROBE_COMPRESS
+    #define LASSO_HOST_STROBE_COMPRESS          (0)
+#else
+    #if (LASSO_HOST_STROBE_COMPRESS == 1)
+        #if (LASSO_HOST_STROBE_ENCODING != LASSO_ENCODING_COBS) && \
+            (LASSO_HOST_STROBE_ENCODING != LASSO_ENCODING_ESCS)
+            #error LASSO_HOST_STROBE_COMPRESS requires LASSO_HOST_STROBE_ENCODING to be COBS or ESCS
+        #endif
+        #if (LASSO_HOST_STROBE_DYNAMICS != LASSO_STROBE_STATIC)
+            #error LASSO_HOST_STROBE_COMPRESS requires static strobing
+        #endif
+        #if (LASSO_HOST_STROBE_EXTERNAL_SOURCE != 0)
+            #error LASSO_HOST_STROBE_COMPRESS cannot be used with an external strobe source
+        #endif
+        #if (LASSO_HOST_STROBE_MSGPACK == 1) || (LASSO_HOST_STROBE_SCATTER_GATHER == 1)
+            #error LASSO_HOST_STROBE_COMPRESS cannot be used with msgpack strobes or scatter-gather
+        #endif
+    #elif (LASSO_HOST_STROBE_COMPRESS != 0)
+        #error LASSO_HOST_STROBE_COMPRESS must be 0 or 1
+    #endif
+#endif
+
+#ifndef LASSO_HOST_STROBE_COMPRESS_STRIDE
+    #define LASSO_HOST_STROBE_COMPRESS_STRIDE   (4)
+#endif
+
+#if (LASSO_HOST_STROBE_COMPRESS_STRIDE == 1)
+    #define LASSO_STROBE_COMPRESS_LOG2          (0)
+#elif (LASSO_HOST_STROBE_COMPRESS_STRIDE == 2)
+    #define LASSO_STROBE_COMPRESS_LOG2          (1)
+#elif (LASSO_HOST_STROBE_COMPRESS_STRIDE == 4)
+    #define LASSO_STROBE_COMPRESS_LOG2          (2)
+#elif (LASSO_HOST_STROBE_COMPRESS_STRIDE == 8)
+    #define LASSO_STROBE_COMPRESS_LOG2          (3)
+#else
+    #error LASSO_HOST_STROBE_COMPRESS_STRIDE must be 1, 2, 4 or 8
+#endif
+
+// Lasso host capture ring (oscilloscope mode) size in [Bytes], 0 = none
+#ifndef LASSO_HOST_CAPTURE_SIZE
+    #define LASSO_HOST_CAPTURE_SIZE             (0)
+#else
+    #if (LASSO_HOST_CAPTURE_SIZE < 0)
+        #error LASSO_HOST_CAPTURE_SIZE must not be negative
+    #endif
+    #if (LASSO_HOST_CAPTURE_SIZE > 0)
+        #if (LASSO_HOST_STROBE_DYNAMICS != LASSO_STROBE_STATIC)
+            #error LASSO_HOST_CAPTURE_SIZE requires static strobing
+        #endif
+        #if (LASSO_HOST_STROBE_BUFFERS > 1)
+            #error LASSO_HOST_CAPTURE_SIZE requires a single strobe buffer
+        #endif
+        #if (LASSO_HOST_STROBE_EXTERNAL_SOURCE != 0) || (LASSO_HOST_STROBE_SCATTER_GATHER == 1)
+            #error LASSO_HOST_CAPTURE_SIZE cannot be used with an external strobe source or scatter-gather
+        #endif
+        #if (LASSO_HOST_STROBE_COMPRESS == 1)
+            #error LASSO_HOST_CAPTURE_SIZE cannot be used with strobe compression
+        #endif
+    #endif
+#endif
+
+// Lasso host strobe snapshot (consistent cell groups, see lasso_hostPublishBegin())
+#ifndef LASSO_HOST_SNAPSHOT
+    #define LASSO_HOST_SNAPSHOT                 (0)
+#else
+    #if (LASSO_HOST_SNAPSHOT == 1)
+        #if (LASSO_HOST_STROBE_DYNAMICS != LASSO_STROBE_STATIC)
+            #error LASSO_HOST_SNAPSHOT requires static strobing
+        #endif
+        #if (LASSO_HOST_STROBE_EXTERNAL_SOURCE != 0) || (LASSO_HOST_STROBE_SCATTER_GATHER == 1)
+            #error LASSO_HOST_SNAPSHOT cannot be used with an external strobe source or scatter-gather
+        #endif
+        #if (LASSO_HOST_STROBE_MSGPACK == 1)
+            #error LASSO_HOST_SNAPSHOT cannot be used with msgpack strobes
+        #endif
+    #endif
+#endif
+
+#ifndef LASSO_HOST_SNAPSHOT_RETRIES
+    #define LASSO_HOST_SNAPSHOT_RETRIES         (2)
+#else
+    #if (LASSO_HOST_SNAPSHOT_RETRIES < 0) || (LASSO_HOST_SNAPSHOT_RETRIES > 255)
+        #error LASSO_HOST_SNAPSHOT_RETRIES must be within 0..255
+    #endif
+#endif
+
+// Lasso host static dataspace (const data cell table, see lasso_hostRegisterDataspace())
+#ifndef LASSO_HOST_DATASPACE_STATIC
+    #define LASSO_HOST_DATASPACE_STATIC         (0)
+#else
+    #if (LASSO_HOST_DATASPACE_STATIC == 1)
+        #if (LASSO_HOST_TIMESTAMP == 1)
+            #error LASSO_HOST_DATASPACE_STATIC requires LASSO_HOST_TIMESTAMP (0), declare timestamp in table
+        #endif
+        #if (LASSO_HOST_PERF_COUNTERS == 1)
+            #error LASSO_HOST_DATASPACE_STATIC cannot be used with LASSO_HOST_PERF_COUNTERS
+        #endif
+        #if (LASSO_HOST_STROBE_DYNAMICS == LASSO_STROBE_DELTA) || (LASSO_HOST_STROBE_RATE_GROUPS == 1)
+            #error LASSO_HOST_DATASPACE_STATIC cannot be used with delta strobing or rate groups
+        #endif
+        #if (LASSO_HOST_STROBE_MSGPACK == 1)
+            #error LASSO_HOST_DATASPACE_STATIC cannot be used with msgpack strobes
+        #endif
+        #if (LASSO_HOST_STROBE_EXTERNAL_SOURCE != 0)
+            #error LASSO_HOST_DATASPACE_STATIC cannot be used with an external strobe source
+        #endif
+    #endif
+#endif
+
 #ifndef LASSO_HOST_RESPONSE_LATENCY_TICKS
     #define LASSO_HOST_RESPONSE_LATENCY_TICKS  (1)
 #else
@@ -149,4 +566,126 @@
     #endif
 #endif    
 
+// Lasso host controls fast path: fixed controls frame payload in Bytes (0 = off)
+#ifndef LASSO_HOST_CONTROLS_SIZE
+    #define LASSO_HOST_CONTROLS_SIZE            (0)
+#else
+    #if (LASSO_HOST_CONTROLS_SIZE < 0)
+        #error LASSO_HOST_CONTROLS_SIZE must not be negative
+    #endif
+    #if (LASSO_HOST_CONTROLS_SIZE > 0)
+        #if (LASSO_HOST_COMMAND_ENCODING != LASSO_ENCODING_COBS) && \
+            (LASSO_HOST_COMMAND_ENCODING != LASSO_ENCODING_ESCS)
+            #error LASSO_HOST_CONTROLS_SIZE requires COBS or ESCS command encoding
+        #endif
+        #if (1 + LASSO_HOST_CONTROLS_SIZE + LASSO_HOST_COMMAND_CRC_ENABLE * LASSO_HOST_CRC_BYTEWIDTH > \
+             LASSO_HOST_COMMAND_BUFFER_SIZE)
+            #error LASSO_HOST_CONTROLS_SIZE exceeds LASSO_HOST_COMMAND_BUFFER_SIZE
+        #endif
+    #endif
+#endif
+
+// atomic compare-and-swap (uint32_t* p, uint32_t* expected, uint32_t desired)
+// and memory barrier for the notification queue, the strobe snapshot and the
+// controls fast path, to be replaced e.g. by versions disabling interrupts on
+// cores without exclusive access (LDREX)
+#if (LASSO_HOST_NOTIFICATION_QUEUE > 0) || (LASSO_HOST_SNAPSHOT == 1) || \
+    (LASSO_HOST_CONTROLS_SIZE > 0)
+    #ifndef LASSO_HOST_CAS
+        #define LASSO_HOST_CAS(p, e, d)        __atomic_compare_exchange_n((p), (e), (d), false, \
+                                                   __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE)
+    #endif
+    #ifndef LASSO_HOST_BARRIER
+        #define LASSO_HOST_BARRIER()           __atomic_thread_fence(__ATOMIC_SEQ_CST)
+    #endif
+#endif
+
+// Lasso host link scheduler (strict priority or weighted link shares)
+#ifndef LASSO_HOST_LINK_SCHEDULER
+    #define LASSO_HOST_LINK_SCHEDULER   LASSO_LINK_PRIORITY
+#endif
+
+#if (LASSO_HOST_LINK_SCHEDULER == LASSO_LINK_WEIGHTED)
+    #ifndef LASSO_HOST_LINK_SHARE_RESPONSE
+        #define LASSO_HOST_LINK_SHARE_RESPONSE      (10)
+    #endif
+    #ifndef LASSO_HOST_LINK_SHARE_NOTIFICATION
+        #define LASSO_HOST_LINK_SHARE_NOTIFICATION  (5)
+    #endif
+    #ifndef LASSO_HOST_LINK_LATENCY_TICKS
+        #define LASSO_HOST_LINK_LATENCY_TICKS       (LASSO_HOST_RESPONSE_LATENCY_TICKS)
+    #endif
+
+    #if (LASSO_HOST_LINK_SHARE_RESPONSE < 1) || (LASSO_HOST_LINK_SHARE_NOTIFICATION < 1)
+        #error LASSO_HOST_LINK_SHARE_RESPONSE/NOTIFICATION must be at least 1
+    #endif
+    #if (LASSO_HOST_LINK_SHARE_RESPONSE + LASSO_HOST_LINK_SHARE_NOTIFICATION > 99)
+        #error LASSO_HOST_LINK_SHARE_RESPONSE + LASSO_HOST_LINK_SHARE_NOTIFICATION must be < 100
+    #endif
+    #if (LASSO_HOST_LINK_LATENCY_TICKS < 1)
+        #error Minimum for LASSO_HOST_LINK_LATENCY_TICKS is 1
+    #endif
+    #if (LASSO_HOST_COMMAND_ENCODING == LASSO_ENCODING_RN)
+        #error LASSO_LINK_WEIGHTED requires COBS or ESCS encoding
+    #endif
+#elif (LASSO_HOST_LINK_SCHEDULER != LASSO_LINK_PRIORITY)
+    #error LASSO_HOST_LINK_SCHEDULER must be LASSO_LINK_PRIORITY or LASSO_LINK_WEIGHTED
+#endif
+
+// Conservative arena size of the default instance for "cells" data cells
+// (including built-in timestamp) with "payload" strobe Bytes in total;
+// lasso_hostGetArenaUsed() reports the exact requirement after boot
+#if (LASSO_HOST_NOTIFICATIONS == 1)
+    #define LASSO_ARENA_NOTIFICATION_BYTES  (2 * (LASSO_HOST_NOTIFICATION_BUFFER_SIZE + 8))
+#else
+    #define LASSO_ARENA_NOTIFICATION_BYTES  (0)
+#endif
+
+#if (UINTPTR_MAX > 0xFFFFFFFFu)
+    #define LASSO_ARENA_CELL_BYTES          (160)   //<! data cell and tables
+    #define LASSO_ARENA_LOG_RECORD_BYTES    (32)    //<! notification queue record
+#else
+    #define LASSO_ARENA_CELL_BYTES          (96)
+    #define LASSO_ARENA_LOG_RECORD_BYTES    (24)
+#endif
+
+// Arena block alignment: LASSO_MEMORY_ALIGN, but at least pointer width
+// (arena records hold pointers, and 64-bit fields on 64-bit hosts)
+#if (UINTPTR_MAX > 0xFFFFFFFFu) && (LASSO_MEMORY_ALIGN < 8)
+    #define LASSO_ARENA_ALIGN               (8)
+#elif (LASSO_MEMORY_ALIGN < 4)
+    #define LASSO_ARENA_ALIGN               (4)
+#else
+    #define LASSO_ARENA_ALIGN               LASSO_MEMORY_ALIGN
+#endif
+
+#define LASSO_HOST_ARENA_BYTES(cells, payload) \
+    ((cells) * LASSO_ARENA_CELL_BYTES \
+    + LASSO_HOST_STROBE_BUFFERS * 2 * (2 * (payload) + 4 * (cells) + 64) \
+    + 2 * (LASSO_HOST_RESPONSE_BUFFER_SIZE + 8) \
+    + LASSO_ARENA_NOTIFICATION_BYTES \
+    + LASSO_HOST_COMMAND_QUEUE * LASSO_HOST_COMMAND_BUFFER_SIZE \
+    + LASSO_HOST_RECEIVE_RING_SIZE \
+    + 2 * LASSO_HOST_ESCS_WINDOW_SIZE \
+    + LASSO_HOST_STROBE_COMPRESS * (2 * (payload) + 8) \
+    + LASSO_HOST_CAPTURE_SIZE \
+    + LASSO_HOST_NOTIFICATION_QUEUE * LASSO_ARENA_LOG_RECORD_BYTES \
+    + 8 * LASSO_ARENA_ALIGN)
+
+// Lasso host arena (0 = memory from LASSO_HOST_MALLOC, 1 = bump allocator)
+#ifndef LASSO_HOST_ARENA
+    #define LASSO_HOST_ARENA            (0)
+#endif
+
+#if (LASSO_HOST_ARENA == 1)
+    #ifndef LASSO_HOST_ARENA_SIZE
+        #define LASSO_HOST_ARENA_SIZE   (0)     //<! 0 = lasso_hostRegisterArena()
+    #endif
+    #if (LASSO_HOST_ARENA_SIZE < 0)
+        #error LASSO_HOST_ARENA_SIZE must not be negative
+    #endif
+#elif (LASSO_HOST_ARENA != 0)
+    #error LASSO_HOST_ARENA must be 0 or 1
+#endif
+
 #endif /* LASSO_DEFAULTS_H */
\ No newline at end of file
@@ -28,6 +28,10 @@
     #define EIO 5           /* I/O error */
 #endif
 
+#ifndef EAGAIN
+    #define EAGAIN 11       /* No more processes / try again */
+#endif
+
 #ifndef EACCES
     #define EACCES 13       /* Permission denied */
 #endif
@@ -97,8 +97,14 @@
 /*  - N dataCell structs (28 Bytes each, 32 on non-packed systems)            */
 /*  - 2/3 dataFrame structs (24 Bytes each, 32 on non-packed systems)         */
 /*  - strobe buffer (depends on size of memory cells linked to DCs)           */
+/*    (times LASSO_HOST_STROBE_BUFFERS, if a strobe buffer ring is used)      */
 /*  - some overhead for msgpack, CRC, RN, ESC, COBS coding (max. 16 Bytes)    */
 /*  - receive (incoming) buffer size                                          */
+/*  - strobe copy plan (12 Bytes per DC, if LASSO_HOST_STROBE_COPY_PLAN)      */
+/*  - strobe segment list (8 Bytes per DC, replaces strobe buffer, if         */
+/*    LASSO_HOST_STROBE_SCATTER_GATHER)                                       */
+/*  - ESCS staging window (2x LASSO_HOST_ESCS_WINDOW_SIZE, replaces the 2x    */
+/*    worst case allocation of ESCS frame buffers)                            */
 /*  - response (outgoing) buffer size                                         */
 /*  - notification (outgoing) buffer size (if notifications are enabled)      */
 /*                                                                            */
@@ -125,14 +131,19 @@
 #ifdef INCLUDE_LASSO_HOST       // refer to "lasso_host_config.h"
 
 #if (LASSO_HOST_PROCESSING_MODE == LASSO_ASCII_MODE)
-    #include <stdio.h>
+    #if (LASSO_HOST_ASCII_BUILTIN == 1)
+        #include "ascii/ascii.h"
+    #else
+        #include <inttypes.h>
+        #include <stdio.h>
+    #endif
 #endif
 
 #include <stddef.h>
 #include <stdlib.h>
 #include <string.h>
 
-#if (LASSO_HOST_PROCESSING_MODE == LASSO_MSGPACK_MODE)
+#if (LASSO_HOST_PROCESSING_MODE == LASSO_MSGPACK_MODE) || (LASSO_HOST_STROBE_MSGPACK == 1)
     #include "msgpack/msgpack.h"
 #endif
 
@@ -144,6 +155,10 @@
     #include "encodings/escs.h"
 #endif
 
+#if (LASSO_HOST_CRC_ENGINE == LASSO_CRC_TABLE)
+    #include "crc/crc.h"
+#endif
+
 
 //---------//
 // Defines //
@@ -158,21 +173,127 @@
 // Lasso host input commands (valid commands are in ASCII space 0...127)
 #define LASSO_HOST_INVALID_OPCODE           (0)     //!< invalid opcode
 #define LASSO_HOST_SET_ADVERTISE            'A'     //!< enable advertising
+#define LASSO_HOST_SET_CAPTURE              'C'     //!< arm capture ring
 #define LASSO_HOST_SEND_NOTIFICATION        'N'     //!< send notification
 #define LASSO_HOST_SET_STROBE_PERIOD        'P'     //!< set strobe period
 #define LASSO_HOST_SET_DATACELL_STROBE      'S'     //!< set data cell strobe
 #define LASSO_HOST_SET_DATACELL_VALUE       'V'     //!< set value of data cell
+#define LASSO_HOST_SET_DATACELL_VALUE_HASH  'H'     //!< set value of data cell by name hash
 #define LASSO_HOST_SET_DATASPACE_STROBE     'W'     //!< set data space strobe
 
+#define LASSO_HOST_GET_BATCH                'b'     //!< get batch of data cells
 #define LASSO_HOST_GET_PROTOCOL_INFO        'i'     //!< get protocol info
 #define LASSO_HOST_GET_TIMING_INFO          't'     //!< get timing info
 #define LASSO_HOST_GET_DATACELL_COUNT       'n'     //!< get # of data cells
 #define LASSO_HOST_GET_DATACELL_PARAMS      'p'     //!< get data cell params
 #define LASSO_HOST_GET_DATACELL_VALUE       'v'     //!< get data cell value
+#define LASSO_HOST_GET_DATACELL_VALUE_HASH  'h'     //!< get data cell value by name hash
 
 #define LASSO_HOST_SET_CONTROLS             (0xC1)  //<! R/C mode controls
 #define LASSO_HOST_INVALID_MSGPACK_CODE     (0xC1)  //<! ESCS/COBS interleave
 
+// ASCII mode number conversion, built-in routines or stdio:
+// - LASSO_SCAN_x(s, p): read number from string s to *p, true on success
+// - LASSO_PRINT_x(d, v): write v and ',' to string d, return string length
+#if (LASSO_HOST_PROCESSING_MODE == LASSO_ASCII_MODE)
+#if (LASSO_HOST_ASCII_BUILTIN == 1)
+    #define LASSO_SCAN_CHAR(s, p)           ((*(p) = *(s)) != 0)
+    #define LASSO_SCAN_UINT32(s, p)         (ASCII_parse_uint32((s), (p)) != 0)
+    #define LASSO_SCAN_INT32(s, p)          (ASCII_parse_int32((s), (p)) != 0)
+    #define LASSO_SCAN_UINT16(s, p)         (ASCII_parse_uint16((s), (p)) != 0)
+    #define LASSO_SCAN_INT16(s, p)          (ASCII_parse_int16((s), (p)) != 0)
+    #define LASSO_SCAN_UINT64(s, p)         (ASCII_parse_uint64((s), (p)) != 0)
+    #define LASSO_SCAN_INT64(s, p)          (ASCII_parse_int64((s), (p)) != 0)
+    #define LASSO_SCAN_FLOAT(s, p)          (ASCII_parse_float((s), (p)) != 0)
+    #define LASSO_SCAN_DOUBLE(s, p)         (ASCII_parse_double((s), (p)) != 0)
+    #define LASSO_PRINT_UINT32(d, v)        ASCII_print_uint32((d), (uint32_t)(v), ',')
+    #define LASSO_PRINT_INT32(d, v)         ASCII_print_int32((d), (int32_t)(v), ',')
+    #define LASSO_PRINT_FLOAT(d, v)         ASCII_print_float((d), (v), ',')
+    #define LASSO_PRINT_DOUBLE(d, v)        ASCII_print_double((d), (v), ',')
+    #define LASSO_PRINT_CHAR(d, c)          ASCII_print_char((d), (c), ',')
+    #define LASSO_PRINT_STRING(d, s)        ASCII_print_string((d), (s), ',')
+#else
+    #define LASSO_SCAN_CHAR(s, p)           (sscanf((s), "%c", (char*)(p)) == 1)
+    #define LASSO_SCAN_UINT32(s, p)         (sscanf((s), "%" SCNu32, (uint32_t*)(p)) == 1)
+    #define LASSO_SCAN_INT32(s, p)          (sscanf((s), "%" SCNi32, (int32_t*)(p)) == 1)
+    #define LASSO_SCAN_UINT16(s, p)         (sscanf((s), "%" SCNu16, (uint16_t*)(p)) == 1)
+    #define LASSO_SCAN_INT16(s, p)          (sscanf((s), "%" SCNi16, (int16_t*)(p)) == 1)
+    #define LASSO_SCAN_UINT64(s, p)         (sscanf((s), "%" SCNu64, (uint64_t*)(p)) == 1)
+    #define LASSO_SCAN_INT64(s, p)          (sscanf((s), "%" SCNi64, (int64_t*)(p)) == 1)
+    #define LASSO_SCAN_FLOAT(s, p)          (sscanf((s), "%f", (p)) == 1)
+    #define LASSO_SCAN_DOUBLE(s, p)         (sscanf((s), "%lf", (p)) == 1)
+    #define LASSO_PRINT_UINT32(d, v)        sprintf((d), "%" PRIu32 ",", (uint32_t)(v))
+    #define LASSO_PRINT_INT32(d, v)         sprintf((d), "%" PRIi32 ",", (int32_t)(v))
+    #define LASSO_PRINT_FLOAT(d, v)         sprintf((d), "%f,", (v))
+    #define LASSO_PRINT_DOUBLE(d, v)        sprintf((d), "%lf,", (v))
+    #define LASSO_PRINT_CHAR(d, c)          sprintf((d), "%c,", (c))
+    #define LASSO_PRINT_STRING(d, s)        sprintf((d), "%s,", (s))
+#endif
+#endif
+
+// COBS payload offset in frame buffer and preparation of freshly loaded frame:
+// - chunked frames: 2 Byte header, save 3rd Byte crushed by COBS_encode()
+// - whole frames: header room for in-place encoding, mark as not yet encoded
+#if (LASSO_HOST_COBS_CHUNKED_FRAMES == 1)
+    #define LASSO_COBS_OFFSET(f)            (2)
+    #define LASSO_COBS_PREPARE(f)           ((f).COBS_backup = (f).frame[2])
+#else
+    #define LASSO_COBS_OFFSET(f)            ((f).COBS_offset)
+    #define LASSO_COBS_PREPARE(f)           ((f).COBS_backup = 0)
+#endif
+
+// ESCS payload offset in frame buffer:
+// - 2x buffer: payload in upper half, encoded to lower half
+// - staging window: payload only, encoded in parts to escsWindow
+#if (LASSO_HOST_ESCS_WINDOW_SIZE == 0)
+    #define LASSO_ESCS_OFFSET(f)            ((f).Bytes_max)
+#else
+    #define LASSO_ESCS_OFFSET(f)            (0)
+#endif
+
+// Bytes left free in front of a strobe buffer, such that the aligned layout
+// (LASSO_HOST_STROBE_ALIGN) behind encoding header and 0xC1 strobe marker
+// starts on a LASSO_MEMORY_ALIGN boundary (ESCS offset is a multiple of it)
+#if (LASSO_HOST_STROBE_ALIGN == 1) && (LASSO_HOST_STROBE_MSGPACK == 0) && \
+    (LASSO_HOST_STROBE_ENCODING == LASSO_ENCODING_COBS)
+    #define LASSO_STROBE_LEAD(f)            ((uint32_t)-(LASSO_COBS_OFFSET(f) + 1) & (LASSO_MEMORY_ALIGN - 1))
+#elif (LASSO_HOST_STROBE_ALIGN == 1) && (LASSO_HOST_STROBE_MSGPACK == 0) && \
+    (LASSO_HOST_STROBE_ENCODING == LASSO_ENCODING_ESCS)
+    #define LASSO_STROBE_LEAD(f)            ((uint32_t)(LASSO_MEMORY_ALIGN - 1))
+#else
+    #define LASSO_STROBE_LEAD(f)            (0)
+#endif
+
+// strobe CRC computed while sampling data cells with an incremental CRC
+// (static, uncompressed strobes only, dynamic strobe mask is completed after sampling)
+#if (LASSO_HOST_STROBE_CRC_ENABLE == 1) && \
+    (LASSO_HOST_STROBE_DYNAMICS == LASSO_STROBE_STATIC) && \
+    (LASSO_HOST_STROBE_EXTERNAL_SOURCE == 0) && \
+    (LASSO_HOST_STROBE_MSGPACK == 0) && \
+    (LASSO_HOST_STROBE_COMPRESS == 0)
+    #define LASSO_STROBE_CRC_INLINE         (1)
+#else
+    #define LASSO_STROBE_CRC_INLINE         (0)
+#endif
+
+// streams scheduled by weighted link scheduler (strobe, response, notification)
+#if (LASSO_HOST_LINK_SCHEDULER == LASSO_LINK_WEIGHTED)
+    #if (LASSO_HOST_NOTIFICATIONS == 1)
+    #define LASSO_LINK_STREAMS              (3)
+    #define LASSO_LINK_SHARE_STROBE         (100 - LASSO_HOST_LINK_SHARE_RESPONSE - LASSO_HOST_LINK_SHARE_NOTIFICATION)
+    #else
+    #define LASSO_LINK_STREAMS              (2)
+    #define LASSO_LINK_SHARE_STROBE         (100 - LASSO_HOST_LINK_SHARE_RESPONSE)
+    #endif
+    #define LASSO_LINK_STRIDE(share)        (10000 / (share))   // pass per Byte
+#endif
+
+// capture ring (oscilloscope mode) states
+#define LASSO_CAPTURE_IDLE                  (0)     // regular strobing
+#define LASSO_CAPTURE_ARMED                 (1)     // sampling, waiting for trigger
+#define LASSO_CAPTURE_POST                  (2)     // triggered, post-trigger samples
+#define LASSO_CAPTURE_READOUT               (3)     // frozen, burst transmission
+
 // Lasso data cell types
 #define LASSO_DATACELL_BYTEWIDTH_1          (0x0000)
 #define LASSO_DATACELL_BYTEWIDTH_2          (0x0002)
@@ -187,6 +308,52 @@
 #define LASSO_DATACELL_TYPE_BYTEWIDTH_MASK  (LASSO_DATACELL_TYPE_MASK | \
                                              LASSO_DATACELL_BYTEWIDTH_MASK)
 
+// Byte width of a data cell's atomic type (1, 2, 4 or 8) from its control code
+#define LASSO_DATACELL_BYTEWIDTH(ctrl)      (((ctrl) & LASSO_DATACELL_BYTEWIDTH_MASK) ? \
+                                             ((ctrl) & LASSO_DATACELL_BYTEWIDTH_MASK) : 1)
+
+// rank of a Byte width (0, 1, 2, 3 for 1, 2, 4, 8), see LASSO_HOST_STROBE_ALIGN
+#define LASSO_BYTEWIDTH_RANK(width)         (((width) == 8) ? 3 : ((width) >> 1))
+
+// data cell traversal, strobe membership and update rate countdown:
+// data cells are linked in RAM, or they are a const table (in flash) whose
+// mutable state lives in a bitmap and a countdown array (in RAM)
+#if (LASSO_HOST_DATASPACE_STATIC == 1)
+    #define LASSO_CELL_NUM(dC)              ((uint32_t)((dC) - lh->dataCellFirst))
+    #define LASSO_CELL_NEXT(dC)             (((dC) == lh->dataCellLast) ? NULL : (dC) + 1)
+    #define LASSO_CELL_ACTIVE(dC)           (lh->dataCellActive[LASSO_CELL_NUM(dC) >> 3] & \
+                                             (1 << (LASSO_CELL_NUM(dC) & 7)))
+    #define LASSO_CELL_ACTIVATE(dC)         (lh->dataCellActive[LASSO_CELL_NUM(dC) >> 3] |= \
+                                             (1 << (LASSO_CELL_NUM(dC) & 7)))
+    #define LASSO_CELL_DEACTIVATE(dC)       (lh->dataCellActive[LASSO_CELL_NUM(dC) >> 3] &= \
+                                             ~(1 << (LASSO_CELL_NUM(dC) & 7)))
+    #define LASSO_CELL_CTRL(dC)             (((dC)->ctrl & LASSO_DATACELL_DISABLE_MASK) | \
+                                             (LASSO_CELL_ACTIVE(dC) ? LASSO_DATACELL_ENABLE_MASK : 0))
+    #define LASSO_CELL_COUNTDOWN(dC)        (--lh->dataCellCountdown[LASSO_CELL_NUM(dC)] == 0)
+    #define LASSO_CELL_RELOAD(dC)           (lh->dataCellCountdown[LASSO_CELL_NUM(dC)] = \
+                                             (uint16_t)((dC)->update_rate >> 16))
+#else
+    #define LASSO_CELL_NEXT(dC)             ((dC)->next)
+    #define LASSO_CELL_ACTIVE(dC)           ((dC)->ctrl & LASSO_DATACELL_STROBE)
+    #define LASSO_CELL_ACTIVATE(dC)         ((dC)->ctrl |= LASSO_DATACELL_ENABLE_MASK)
+    #define LASSO_CELL_DEACTIVATE(dC)       ((dC)->ctrl &= LASSO_DATACELL_DISABLE_MASK)
+    #define LASSO_CELL_CTRL(dC)             ((dC)->ctrl)
+    #define LASSO_CELL_COUNTDOWN(dC)        ((--(dC)->update_rate & 0xFFFF) == 0)
+    #define LASSO_CELL_RELOAD(dC)           ((dC)->update_rate += ((dC)->update_rate >> 16))
+#endif
+
+
+// performance counters (no-ops unless LASSO_HOST_PERF_COUNTERS)
+#if (LASSO_HOST_PERF_COUNTERS == 1)
+    #define LASSO_PERF_INC(idx)             (lh->perf[idx]++)
+    #define LASSO_PERF_SENT(ptr, n)         (lh->perf[((ptr) == &lh->strobe) ? LASSO_PERF_STROBE_BYTES : \
+                                             ((ptr) == &lh->response) ? LASSO_PERF_RESPONSE_BYTES : \
+                                             LASSO_PERF_NOTIFICATION_BYTES] += (n))
+#else
+    #define LASSO_PERF_INC(idx)             ((void)0)
+    #define LASSO_PERF_SENT(ptr, n)         ((void)0)
+#endif
+
 
 // convenience function to transform x into string value
 #define _TOSTR(x) #x
@@ -234,11 +401,39 @@ static uint32_t lasso_crcDefaultCallback (
 );
 #endif
 
+#if (LASSO_HOST_STROBE_SCATTER_GATHER == 1)
+static int32_t lasso_sgDefaultCallback (
+    const lasso_segment* seg,               //!< segment list start pointer
+    uint32_t cnt                            //!< number of segments to send
+);
+#endif
+
+#if (LASSO_HOST_DATASPACE_STATIC == 0) && (LASSO_HOST_MULTI_INSTANCE == 0)
+static int32_t lasso_hostRegisterDataCell_r (
+    lasso_host_t* lh,                       //!< Lasso host instance
+    uint16_t ctrl,                          //!< memory cell control/type
+    uint16_t count,                         //!< array size
+    const void* ptr,                        //!< pointer to memory cell
+    const char* const name,                 //!< identifier string
+    const char* const unit,                 //!< unit string
+#if (LASSO_HOST_STROBE_DYNAMICS == LASSO_STROBE_STATIC)
+    const lasso_chgCallback onChange        //!< user callback for change event
+#else
+    const lasso_chgCallback onChange,       //!< user callback for change event
+    uint16_t update_rate                    //!< update rate info
+#endif
+);
+#endif
+
 
 //------------------//
 // Private Typedefs //
 //------------------//
 
+#if (LASSO_HOST_DATASPACE_STATIC == 1)
+// const table entry, see lasso_hostRegisterDataspace()
+typedef const lasso_dataCell dataCell;
+#else
 // 28 Bytes total (packed), up to 32 Bytes total (on unpacked 32-bit system)
 typedef struct DATACELL
 #if (LASSO_HOST_UNALIGNED_MEMORY_ACCESS == 1)
@@ -253,9 +448,23 @@ typedef struct DATACELL
     lasso_chgCallback onChange; //!< callback for change event
     uint32_t update_rate;       //!< update rate of underlying memory cell (16/16 bits)
     struct DATACELL* next;      //!< singly-linked list
+#if (LASSO_HOST_STROBE_DYNAMICS == LASSO_STROBE_DELTA)
+    uint32_t hash;              //!< hash of last transmitted value (delta strobing)
+#endif
+#if (LASSO_HOST_STROBE_RATE_GROUPS == 1)
+    uint8_t index;              //!< registration index (= strobe mask bit)
+    struct DATACELL* groupNext; //!< singly-linked list of same rate group
+#endif
+#if (LASSO_HOST_STROBE_MSGPACK == 1)
+    uint8_t packHeader[3];      //!< msgpack array/raw header (template)
+    uint8_t packHeaderBytes;    //!< length of packHeader (0 for scalars)
+    uint8_t packCode;           //!< msgpack code of elements (0 for raw)
+    uint8_t packElementBytes;   //!< packed Bytes per element
+#endif
 } dataCell;
+#endif
 
-// 24 Bytes total (packed), up to 32 Bytes total (on unpacked 32-bit system)
+// 26 Bytes total (packed), up to 32 Bytes total (on unpacked 32-bit system)
 typedef struct DATAFRAME
 #if (LASSO_HOST_UNALIGNED_MEMORY_ACCESS == 1)
     __attribute__((packed))
@@ -269,64 +478,342 @@ typedef struct DATAFRAME
     uint32_t Byte_count;        //!< number of Bytes remaining to be transmitted
     uint32_t Bytes_max;         //!< maximum of Bytes allowed in buffer any time
     uint32_t Bytes_total;       //!< current number of Bytes in buffer
+    uint16_t COBS_offset;       //!< payload offset (only for whole-frame COBS)
 } dataFrame;
 
+#if (LASSO_HOST_DATACELL_INDEX == 1)
+// 8 Bytes total, one entry per data cell, sorted by name hash
+typedef struct NAMEENTRY {
+    uint32_t hash;              //!< hash of data cell name string (FNV-1a)
+    uint8_t num;                //!< number in registration order
+} nameEntry;
+#endif
+
+#if (LASSO_HOST_STROBE_COPY_PLAN == 1)
+// 12 Bytes total, one entry per run of adjacent memory cells of same Byte width
+typedef struct COPYOP {
+    const void* src;            //!< pointer to first underlying memory cell
+    uint32_t Bytes;             //!< number of Bytes to copy
+    uint32_t width;             //!< Byte width of atomic type (1, 2, 4, 8)
+} copyOp;
+#endif
+
+#if (LASSO_HOST_NOTIFICATION_QUEUE > 0)
+// one entry per queued notification, see lasso_hostLog()
+typedef struct LOGRECORD {
+    volatile uint32_t seq;      //!< sequence number (record free, or ready to send)
+    const char* fmt;            //!< static format string
+    uint32_t arg[3];            //!< arguments
+} logRecord;
+#endif
+
+#if (LASSO_HOST_CONTROLS_SIZE > 0)
+// controls triple buffer: swap buffer index, flag if not yet delivered
+#define LASSO_CONTROLS_INDEX                (0x03)
+#define LASSO_CONTROLS_FRESH                (0x04)
+#endif
+
+
+// timestamp data cell: 32 bits, or 64 bits (wrap-extended hardware timer)
+#if (LASSO_HOST_TIMESTAMP_64BIT == 1)
+typedef uint64_t lasso_timestamp_t;
+#define LASSO_TIMESTAMP_TYPE                (0x0028)    // LASSO_UINT64
+#else
+typedef uint32_t lasso_timestamp_t;
+#define LASSO_TIMESTAMP_TYPE                LASSO_UINT32
+#endif
+
 
 //-------------------//
 // Private Variables //
 //-------------------//
 
-static uint8_t   dataCellCount = 0;         //!< number of registered DCs
-static dataCell* dataCellFirst = NULL;      //!< pointer to first DC structure
-static dataCell* dataCellLast = NULL;       //!< pointer to last DC structure
-#if (LASSO_HOST_STROBE_DYNAMICS == LASSO_STROBE_DYNAMIC)
-    static uint8_t dataCellMaskBytes = 0;   //!< mask Bytes for strobe dynamics
+// all state of one Lasso host instance (one serial link and its dataspace)
+struct LASSO_HOST {
+    uint8_t   dataCellCount;            //!< number of registered DCs
+    dataCell* dataCellFirst;            //!< pointer to first DC structure
+    dataCell* dataCellLast;             //!< pointer to last DC structure
+#if (LASSO_HOST_DATASPACE_STATIC == 1)
+    uint8_t*  dataCellActive;           //!< strobe membership bitmap
+#if (LASSO_HOST_STROBE_DYNAMICS != LASSO_STROBE_STATIC)
+    uint16_t* dataCellCountdown;        //!< update rate countdowns
+#endif
+#endif
+#if (LASSO_HOST_STROBE_DYNAMICS != LASSO_STROBE_STATIC)
+    uint8_t   dataCellMaskBytes;        //!< mask Bytes for strobe dynamics
+#endif
+#if (LASSO_HOST_STROBE_DYNAMICS == LASSO_STROBE_DELTA) || (LASSO_HOST_STROBE_COMPRESS == 1)
+    uint16_t  strobeKeyframeCountdown;  //!< strobes until next keyframe
+#endif
+#if (LASSO_HOST_STROBE_COMPRESS == 1)
+    uint8_t*  compressRef;              //!< payload of previous strobe (XOR-delta reference)
+    uint8_t*  compressTmp;              //!< byte planes of current strobe
+#endif
+#if (LASSO_HOST_STROBE_RATE_GROUPS == 1)
+    dataCell* rateGroupFirst[LASSO_RATE_GROUPS];    //!< first DC of each rate group
+    dataCell* rateGroupLast[LASSO_RATE_GROUPS];     //!< last DC of each rate group
+    uint16_t  rateGroupUsed;            //!< bitmap of non-empty rate groups
+    uint16_t  strobeCycle;              //!< strobe counter for group schedule
+#endif
+#if (LASSO_HOST_DATACELL_INDEX == 1)
+    dataCell** dataCellTable;           //!< DCs in registration order
+    uint32_t* dataCellBytepos;          //!< Byte positions of DCs in strobe
+    nameEntry* dataCellNames;           //!< DC names sorted by hash
 #endif
 
-static uint8_t*  receiveBuffer = NULL;      //!< buffer for incoming commands
-static uint8_t   receiveBufferIndex = 0;    //!< write index in receiveBuffer
-static uint32_t  receiveTimeout = 0;        //!< receive timeout counter
-static uint8_t   receiveValid = 0;          //!< number of valid command Bytes
+    uint8_t*  receiveBuffer;            //!< buffer for incoming commands
+    uint8_t   receiveBufferIndex;       //!< write index in receiveBuffer
+    uint32_t  receiveTimeout;           //!< receive timeout counter
+    uint8_t   receiveValid;             //!< number of valid command Bytes
+#if (LASSO_HOST_MULTI_INSTANCE == 1)
+#if (LASSO_HOST_COMMAND_ENCODING == LASSO_ENCODING_COBS)
+    COBS_decoder receiveDecoder;        //!< inline decoder state of this link
+#elif (LASSO_HOST_COMMAND_ENCODING == LASSO_ENCODING_ESCS)
+    ESCS_decoder receiveDecoder;        //!< inline decoder state of this link
+#endif
+#endif
+#if (LASSO_HOST_RECEIVE_RING_SIZE > 0)
+    uint8_t*  receiveRing;              //!< ring of received, undecoded Bytes
+    volatile uint32_t receiveRingHead;  //!< write index (producer only)
+    volatile uint32_t receiveRingTail;  //!< read index (consumer only)
+#endif
+#if (LASSO_HOST_CONTROLS_SIZE > 0)
+    uint8_t   controls[3][LASSO_HOST_CONTROLS_SIZE];    //!< latest controls (triple buffer)
+    uint8_t   controlsIn;               //!< buffer written by receive path
+    uint8_t   controlsOut;              //!< buffer delivered to ctlCallback
+    volatile uint32_t controlsSwap;     //!< buffer in between, LASSO_CONTROLS_FRESH if not yet delivered
+#endif
+    uint8_t*  commandBuffer;            //!< command being interpreted
+    uint8_t   commandValid;             //!< number of valid command Bytes
+#if (LASSO_HOST_COMMAND_QUEUE > 1)
+    uint8_t*  commandQueue[LASSO_HOST_COMMAND_QUEUE];       //!< command buffers
+    uint8_t   commandQueueValid[LASSO_HOST_COMMAND_QUEUE];  //!< valid Bytes per command
+    volatile uint8_t commandQueueIn;    //!< commands received (free-running)
+    volatile uint8_t commandQueueOut;   //!< commands handled (free-running)
+#endif
+#if (LASSO_HOST_COMMAND_BATCH == 1)
+    uint8_t   batchCommand[8];          //!< synthesized sub-command of batch
+    uint8_t   batchOpcode;              //!< opcode of sub-commands
+    uint8_t   batchNext;                //!< next data cell number
+    uint16_t  batchRemaining;           //!< sub-commands left to handle
+#endif
 
-static bool      lasso_strobing = false;    //!< global strobe enable flag
-static bool      lasso_advertise = true;    //!< advertise unless client connected
+    bool      lasso_strobing;           //!< global strobe enable flag
+    bool      lasso_advertise;          //!< advertise unless client connected
 
-// user-supplied callbacks
-static lasso_comCallback comCallback = &lasso_comDefaultCallback;   //!< trigger communication
+    // user-supplied callbacks
+    lasso_comCallback comCallback;      //!< trigger communication
+    lasso_txIdle txIdle;                //!< poll transmitter (no completion ISR)
 #if (LASSO_HOST_COMMAND_CRC_ENABLE == 1) || (LASSO_HOST_STROBE_CRC_ENABLE == 1)
-    static lasso_crcCallback crcCallback = &lasso_crcDefaultCallback;    //!< CRC
+    lasso_crcCallback crcCallback;      //!< CRC
+    lasso_crcUpdateCallback crcUpdateCallback;  //!< incremental CRC
+#endif
+    lasso_actCallback actCallback;      //!< strobe de-/activation
+    lasso_perCallback perCallback;      //!< strobe period changed
+    lasso_ctlCallback ctlCallback;      //!< controls changed
+#if (LASSO_HOST_CONTROLS_SIZE > 0)
+    lasso_ctlCallback ctlIsrCallback;   //!< controls received (receive path)
+#endif
+    lasso_cmdCallback cmdCallback;      //!< command received
+#if (LASSO_HOST_MEMCPY_MIN_BYTES > 0)
+    lasso_memcpyCallback memcpyCallback;    //!< memory-to-memory copy
+#endif
+#if (LASSO_HOST_STROBE_SCATTER_GATHER == 1)
+    lasso_sgCallback sgCallback;        //!< strobe SG
+#endif
+#if (LASSO_HOST_TIMESTAMP_TIMER == 1)
+    lasso_timerCallback timerCallback;  //!< free-running hardware timer
+#endif
+#if (LASSO_HOST_CAPTURE_SIZE > 0)
+    lasso_trgCallback trgCallback;      //!< capture trigger
 #endif
-static lasso_actCallback actCallback = NULL;    //!< strobe de-/activation
-static lasso_perCallback perCallback = NULL;    //!< strobe period changed
-static lasso_ctlCallback ctlCallback = NULL;    //!< controls changed
-static lasso_cmdCallback cmdCallback = NULL;    //!< command received
 
-static dataFrame strobe = \
-    { LASSO_HOST_ADVERTISE_PERIOD_TICKS, 0, true, NULL, NULL, 0, 0, 0};
+    dataFrame strobe;                   //!< strobe (and advertising) frame
+    dataFrame response;                 //!< response frame
+#if (LASSO_HOST_NOTIFICATIONS == 1)
+    dataFrame notification;             //!< notification frame
+#if (LASSO_HOST_NOTIFICATION_USE_PRINTF == 1)
+    uint8_t*  printfBuffer;             //!< printf() write position, NULL if no line open
+#endif
+#endif
+#if (LASSO_HOST_NOTIFICATION_QUEUE > 0)
+    logRecord* logQueue;                //!< notification queue (deferred formatting)
+    volatile uint32_t logHead;          //!< next record to be claimed (producers)
+    uint32_t  logTail;                  //!< next record to be sent (consumer only)
+    volatile uint32_t logDropped;       //!< records dropped since last report
+#endif
+    dataFrame* lastFrame;               //!< frame transmitted last
+#if (LASSO_HOST_LINK_SCHEDULER == LASSO_LINK_WEIGHTED)
+    dataFrame* linkOwner;               //!< frame holding the serial link
+    uint32_t  linkClock;                //!< pass of stream served last
+    uint32_t  linkPass[LASSO_LINK_STREAMS];     //!< scaled Bytes sent per stream
+    uint16_t  linkWait[LASSO_LINK_STREAMS];     //!< ticks pending per stream
+#endif
 
-static dataFrame response = \
-    { LASSO_HOST_ROUNDTRIP_LATENCY_TICKS, 0, true, NULL, NULL, 0, \
-        LASSO_HOST_RESPONSE_BUFFER_SIZE, 0};
+#if (LASSO_HOST_STROBE_COPY_PLAN == 1)
+    copyOp*   copyPlan;                 //!< flat strobe copy plan
+    uint8_t   copyPlanOps;              //!< number of ops in copy plan
+#endif
 
-#if (LASSO_HOST_NOTIFICATIONS == 1)
-static dataFrame notification = \
-    { 0, 0, true, NULL, NULL, 0, LASSO_HOST_NOTIFICATION_BUFFER_SIZE, 0};
+#if (LASSO_HOST_STROBE_MSGPACK == 1)
+    uint8_t   packFrameHeader[3];       //!< msgpack array header of strobe
+    uint8_t   packFrameHeaderBytes;     //!< length of packFrameHeader
 #endif
 
-static dataFrame* lastFrame = NULL;
-        
-static uint16_t lasso_strobe_period = LASSO_HOST_STROBE_PERIOD_TICKS;
-//!< at each expiration, strobe period is reloaded from here
+#if (LASSO_HOST_ESCS_WINDOW_SIZE > 0)
+    uint8_t*  escsWindow;               //!< ESCS staging window (2 halves)
+    uint8_t   escsHalf;                 //!< window half for next transmission
+    uint32_t  escsPending;              //!< encoded Bytes in that half
+    bool      escsLast;                 //!< that half ends current frame
+    dataFrame* escsOwner;               //!< frame currently being streamed
+#endif
+
+#if (LASSO_HOST_STROBE_SCATTER_GATHER == 1)
+    lasso_segment* strobeSegments;      //!< scatter-gather strobe list
+    uint8_t   strobeSegmentCount;       //!< number of segments in list
+#endif
+
+#if (LASSO_HOST_STROBE_BUFFERS > 1)
+    uint8_t*  strobeRing[LASSO_HOST_STROBE_BUFFERS];        //!< strobe buffers
+    uint32_t  strobeRingBytes[LASSO_HOST_STROBE_BUFFERS];   //!< sampled Bytes
+    uint8_t   strobeRingHead;           //!< next buffer to be sampled
+    uint8_t   strobeRingTail;           //!< next buffer to be transmitted
+    uint8_t   strobeRingQueued;         //!< sampled, not yet transmitted
+    bool      strobeRingBusy;           //!< tail buffer being transmitted
+#endif
+
+#if (LASSO_HOST_CAPTURE_SIZE > 0)
+    uint8_t*  captureRing;              //!< capture samples (strobes without framing)
+    dataCell* captureCell;              //!< trigger data cell (NULL = trgCallback)
+    float     captureLevel;             //!< trigger level of captureCell
+    float     captureLast;              //!< value of captureCell in previous sample
+    uint16_t  captureDepth;             //!< samples in capture ring
+    uint16_t  capturePre;               //!< pre-trigger samples
+    uint16_t  capturePost;              //!< post-trigger samples left to be sampled
+    uint16_t  captureHead;              //!< next sample to be written or sent
+    uint16_t  captureCount;             //!< samples sampled or left to be sent
+    uint8_t   captureState;             //!< LASSO_CAPTURE_xxx
+#endif
 
-static uint16_t lasso_tick_period = LASSO_HOST_TICK_PERIOD_MS;
-//!< tick period can programmatically be changed at run-time
+#if (LASSO_HOST_SNAPSHOT == 1)
+    volatile uint32_t snapshotSeq;      //!< publish version (bits 31..16), publishers active (bits 15..0)
+#endif
+
+    uint16_t  lasso_strobe_period;      //!< at each expiration, strobe period is reloaded from here
+    uint16_t  lasso_tick_period;        //!< tick period can programmatically be changed at run-time
+    uint16_t  lasso_roundtrip_latency_ticks;
+    uint16_t  lasso_advertise_period_ticks;
+    uint32_t  lasso_overdrive;          //!< non-zero indicates that strobe volume and rate are incompatible
+
+#if (LASSO_HOST_AUTOTUNE == 1)
+    uint16_t  autotunePeriod;           //!< strobe period requested by client (or default)
+    uint16_t  autotuneClock;            //!< tick counter for transmission time measurement
+    uint16_t  autotuneStart;            //!< tick at which strobe transmission was started
+    uint16_t  autotuneDone;             //!< tick at which strobe transmission has finished
+    uint16_t  autotuneBusy;             //!< transmission time of last strobe in [ticks]
+    uint16_t  autotuneNeed;             //!< max. strobe period needed within window
+    uint8_t   autotuneCount;            //!< strobes measured within window
+    bool      autotuneFinished;         //!< strobe transmission finished, not evaluated yet
+#endif
+
+#if (LASSO_HOST_TIMESTAMP == 1)
+    lasso_timestamp_t lasso_timestamp;  //!< tick counter or latched timer (timestamp data cell)
+#endif
+#if (LASSO_HOST_PERF_COUNTERS == 1)
+    uint32_t  perf[LASSO_PERF_COUNTERS];    //!< performance counters ("Perf" data cell)
+#endif
+#if (LASSO_HOST_TIMESTAMP_TIMER == 1) && (LASSO_HOST_TIMESTAMP_64BIT == 1)
+    uint32_t  timerLast;                //!< last timer count read (wrap detection)
+    uint32_t  timerWraps;               //!< timer wrap-arounds (upper 32 bits)
+#endif
+};
 
-static uint16_t lasso_roundtrip_latency_ticks = LASSO_HOST_ROUNDTRIP_LATENCY_TICKS;
+// initial state of a Lasso host instance (all other members are zero)
+#if (LASSO_HOST_COMMAND_CRC_ENABLE == 1) || (LASSO_HOST_STROBE_CRC_ENABLE == 1)
+#if (LASSO_HOST_CRC_ENGINE == LASSO_CRC_TABLE)
+    #define LASSO_INIT_CRC  .crcCallback = &lasso_crcDefaultCallback, \
+                            .crcUpdateCallback = &CRC_update,
+#else
+    #define LASSO_INIT_CRC  .crcCallback = &lasso_crcDefaultCallback,
+#endif
+#else
+    #define LASSO_INIT_CRC
+#endif
+#if (LASSO_HOST_STROBE_RATE_GROUPS == 1)
+    #define LASSO_INIT_RATE_GROUPS  .strobeCycle = 1,
+#else
+    #define LASSO_INIT_RATE_GROUPS
+#endif
+#if (LASSO_HOST_MULTI_INSTANCE == 1) && (LASSO_HOST_COMMAND_ENCODING == LASSO_ENCODING_COBS)
+    #define LASSO_INIT_DECODER  .receiveDecoder = COBS_DECODER_INIT,
+#elif (LASSO_HOST_MULTI_INSTANCE == 1) && (LASSO_HOST_COMMAND_ENCODING == LASSO_ENCODING_ESCS)
+    #define LASSO_INIT_DECODER  .receiveDecoder = ESCS_DECODER_INIT,
+#else
+    #define LASSO_INIT_DECODER
+#endif
+#if (LASSO_HOST_STROBE_SCATTER_GATHER == 1)
+    #define LASSO_INIT_SG   .sgCallback = &lasso_sgDefaultCallback,
+#else
+    #define LASSO_INIT_SG
+#endif
+#if (LASSO_HOST_AUTOTUNE == 1)
+    #define LASSO_INIT_AUTOTUNE .autotunePeriod = LASSO_HOST_STROBE_PERIOD_TICKS,
+#else
+    #define LASSO_INIT_AUTOTUNE
+#endif
+#if (LASSO_HOST_NOTIFICATIONS == 1)
+    #define LASSO_INIT_NOTIFICATION \
+        .notification = { 0, 0, true, NULL, NULL, 0, LASSO_HOST_NOTIFICATION_BUFFER_SIZE, 0},
+#else
+    #define LASSO_INIT_NOTIFICATION
+#endif
+#if (LASSO_HOST_CONTROLS_SIZE > 0)
+    #define LASSO_INIT_CONTROLS .controlsIn = 0, .controlsOut = 1, .controlsSwap = 2,
+#else
+    #define LASSO_INIT_CONTROLS
+#endif
 
-static uint16_t lasso_advertise_period_ticks = LASSO_HOST_ADVERTISE_PERIOD_TICKS;
+#define LASSO_HOST_INSTANCE_INIT { \
+    LASSO_INIT_RATE_GROUPS \
+    LASSO_INIT_DECODER \
+    .lasso_advertise = true, \
+    .comCallback = &lasso_comDefaultCallback, \
+    LASSO_INIT_CRC \
+    LASSO_INIT_SG \
+    .strobe = { LASSO_HOST_ADVERTISE_PERIOD_TICKS, 0, true, NULL, NULL, 0, 0, 0}, \
+    .response = { LASSO_HOST_ROUNDTRIP_LATENCY_TICKS, 0, true, NULL, NULL, 0, \
+        LASSO_HOST_RESPONSE_BUFFER_SIZE, 0}, \
+    LASSO_INIT_NOTIFICATION \
+    LASSO_INIT_CONTROLS \
+    LASSO_INIT_AUTOTUNE \
+    .lasso_strobe_period = LASSO_HOST_STROBE_PERIOD_TICKS, \
+    .lasso_tick_period = LASSO_HOST_TICK_PERIOD_MS, \
+    .lasso_roundtrip_latency_ticks = LASSO_HOST_ROUNDTRIP_LATENCY_TICKS, \
+    .lasso_advertise_period_ticks = LASSO_HOST_ADVERTISE_PERIOD_TICKS }
+
+static lasso_host_t lasso_hostDefault = LASSO_HOST_INSTANCE_INIT;   //!< default instance
+
+// instance served: every function below that touches instance state takes
+// it as lh; lasso_hostXxx_r() serves instance lh, lasso_hostXxx() serves the
+// default instance (the _r variants are public with LASSO_HOST_MULTI_INSTANCE)
+#if (LASSO_HOST_MULTI_INSTANCE == 1)
+    #define LASSO_API_R
+#else
+    #define LASSO_API_R static
+#endif
 
-static uint32_t lasso_overdrive = 0;
-//!< non-zero indicates that strobe volume and rate are incompatible
+// arena: one region shared by all instances, allocated by bump pointer
+#if (LASSO_HOST_ARENA == 1)
+#if (LASSO_HOST_ARENA_SIZE > 0)
+static uint64_t lasso_hostArenaMemory[(LASSO_HOST_ARENA_SIZE + 7) / 8];
+static uint8_t* lasso_hostArenaBase = (uint8_t*)lasso_hostArenaMemory;
+static uint32_t lasso_hostArenaSize = 8 * ((LASSO_HOST_ARENA_SIZE + 7) / 8);
+#else
+static uint8_t* lasso_hostArenaBase = NULL;  //!< see lasso_hostRegisterArena()
+static uint32_t lasso_hostArenaSize = 0;
+#endif
+static uint32_t lasso_hostArenaUsed = 0;
+#endif
 
 
 //---------------//
@@ -337,7 +824,7 @@ static uint32_t lasso_overdrive = 0;
 // bits 0-1     command encoding (RN, COBS, ESCS)
 // bit 2        strobe encoding == command encoding?
 // bit 3        processing mode (ASCII, MSGPACK)
-// bit 4        strobe dynamics (STATIC, DYNAMIC)
+// bit 4        strobe dynamics (STATIC, DYNAMIC or DELTA)
 // bits 5-6     CRC Byte width (1,2,3,4)
 // bit 7        command CRC enable (YES, NO)
 // bit 8        strobe CRC enable (YES, NO)
@@ -349,7 +836,7 @@ static uint32_t lasso_overdrive = 0;
 #define LASSO_PROTOCOL_INFO (((uint32_t)LASSO_HOST_COMMAND_ENCODING) \
 + ((uint32_t)(LASSO_HOST_COMMAND_ENCODING == LASSO_HOST_STROBE_ENCODING) << 2) \
     + ((uint32_t)LASSO_HOST_PROCESSING_MODE << 3) \
-    + ((uint32_t)LASSO_HOST_STROBE_DYNAMICS << 4) \
+    + ((uint32_t)(LASSO_HOST_STROBE_DYNAMICS != LASSO_STROBE_STATIC) << 4) \
     + (((uint32_t)LASSO_HOST_CRC_BYTEWIDTH - 1) << 5) \
     + ((uint32_t)LASSO_HOST_COMMAND_CRC_ENABLE << 7) \
     + ((uint32_t)LASSO_HOST_STROBE_CRC_ENABLE << 8) \
@@ -360,6 +847,35 @@ static uint32_t lasso_overdrive = 0;
 
 static uint32_t lasso_protocol_info = LASSO_PROTOCOL_INFO;
 
+// 32-bit value (extended protocol info, reported only if non-zero):
+// bit 0        whole-frame COBS encoding (YES, NO = chunked 253 Byte frames)
+// bit 1        delta strobes (YES, NO), mask bit = changed datacell
+// bit 2        datacell access by name hash (YES, NO), opcodes 'h' and 'H'
+// bit 3        batched commands (YES, NO), opcode 'b'
+// bits 4-7     command queue depth - 1 (commands in flight)
+// bit 8        msgpack strobes (YES, NO = raw host-endian memory cells)
+// bit 9        compressed strobe payload (YES, NO), see lasso_hostCompressStrobe()
+// bits 10-11   log2 of compression stride (byte planes)
+// bit 12       capture ring (YES, NO), opcode 'C'
+// bit 13       aligned strobe layout (YES, NO = registration order), widest first
+// bits 14-21   controls frame payload size (0 = controls handled as command)
+// bits 22-31   reserved (0)
+
+#define LASSO_PROTOCOL_INFO_EXT (((uint32_t)((LASSO_HOST_COMMAND_ENCODING == LASSO_ENCODING_COBS) && \
+                                             (LASSO_HOST_COBS_CHUNKED_FRAMES == 0))) \
+    + ((uint32_t)(LASSO_HOST_STROBE_DYNAMICS == LASSO_STROBE_DELTA) << 1) \
+    + ((uint32_t)LASSO_HOST_DATACELL_INDEX << 2) \
+    + ((uint32_t)LASSO_HOST_COMMAND_BATCH << 3) \
+    + (((uint32_t)LASSO_HOST_COMMAND_QUEUE - 1) << 4) \
+    + ((uint32_t)LASSO_HOST_STROBE_MSGPACK << 8) \
+    + ((uint32_t)LASSO_HOST_STROBE_COMPRESS << 9) \
+    + ((uint32_t)LASSO_STROBE_COMPRESS_LOG2 << 10) \
+    + ((uint32_t)(LASSO_HOST_CAPTURE_SIZE > 0) << 12) \
+    + ((uint32_t)LASSO_HOST_STROBE_ALIGN << 13) \
+    + ((uint32_t)LASSO_HOST_CONTROLS_SIZE << 14))
+
+static uint32_t lasso_protocol_info_ext = LASSO_PROTOCOL_INFO_EXT;
+
 // 16 character signature that a lasso host strobes (advertises)
 // when not connected to lasso client
 #if (LASSO_HOST_SIGNATURE_IN_SRAM == 1) // place signature in SRAM
@@ -381,15 +897,41 @@ static struct __attribute__((packed)) {
 } lasso_version = {{'v'}, {TOSTR(LASSO_HOST_PROTOCOL_VERSION)}};
 #endif
 
-#if (LASSO_HOST_TIMESTAMP == 1)
-    static uint32_t lasso_timestamp = 0;
-#endif
-
 
 //-------------------//
 // Private functions //
 //-------------------//
 
+/*!
+ *  \brief  Allocate Lasso host memory.
+ *
+ *          With LASSO_HOST_ARENA, memory is taken from the arena by bump
+ *          pointer, in multiples of LASSO_ARENA_ALIGN (LASSO_MEMORY_ALIGN,
+ *          at least pointer width). There is no free().
+ *
+ *  \return Pointer to memory, NULL if out of memory
+ */
+#if (LASSO_HOST_ARENA == 1)
+static void* lasso_hostAlloc (
+    uint32_t size                           //!< number of Bytes
+) {
+    void* p;
+
+    size = (size + (LASSO_ARENA_ALIGN - 1)) & ~(LASSO_ARENA_ALIGN - 1);
+    if (size > lasso_hostArenaSize - lasso_hostArenaUsed) {
+        return NULL;
+    }
+
+    p = lasso_hostArenaBase + lasso_hostArenaUsed;
+    lasso_hostArenaUsed += size;
+
+    return p;
+}
+#else
+#define lasso_hostAlloc(size)   LASSO_HOST_MALLOC(size)
+#endif
+
+
 /*!
  *  \brief  Empty COM callback.
  *
@@ -404,6 +946,22 @@ static int32_t lasso_comDefaultCallback (
     return 0;
 }
 
+/*!
+ *  \brief  Default scatter-gather callback.
+ *
+ *  \return Error code
+ */
+#if (LASSO_HOST_STROBE_SCATTER_GATHER == 1)
+static int32_t lasso_sgDefaultCallback (
+    const lasso_segment* seg,               //!< segment list start pointer
+    uint32_t cnt                            //!< number of segments to send
+) {
+    (void)seg;
+    (void)cnt;
+    return 0;
+}
+#endif
+
 /*!
  *  \brief  Default CRC callback.
  *
@@ -429,17 +987,41 @@ static uint32_t lasso_crcDefaultCallback (
 
 
 /*!
- *  \brief  Append CRC to end of response or strobe frame.
+ *  \brief  Compute CRC over a buffer.
  *
- *  \return Void
+ *          Incremental CRC generator is preferred, if available.
+ *
+ *  \return 32-bit CRC value
  */
 #if (LASSO_HOST_COMMAND_CRC_ENABLE == 1) || (LASSO_HOST_STROBE_CRC_ENABLE == 1)
-static void lasso_hostAppendCRC (
+static uint32_t lasso_hostComputeCRC (
+    lasso_host_t* lh,                       //!< Lasso host instance
     uint8_t* buffer,                        //!< buffer start pointer
     uint32_t cnt                            //!< number of Bytes to iterate over
 ) {
-    uint32_t crc = crcCallback(buffer, cnt);
-    buffer += cnt;
+    if (lh->crcUpdateCallback) {
+        return lh->crcUpdateCallback(0, buffer, cnt);
+    }
+
+    return lh->crcCallback(buffer, cnt);
+}
+#endif
+
+
+/*!
+ *  \brief  Write CRC value to frame.
+ *
+ *  \return Void
+ */
+#if (LASSO_HOST_COMMAND_CRC_ENABLE == 1) || (LASSO_HOST_STROBE_CRC_ENABLE == 1)
+static void lasso_hostWriteCRC (
+    uint8_t* buffer,                        //!< CRC location in frame
+    uint32_t crc                            //!< CRC value
+) {
+#if (LASSO_HOST_CRC_BYTEWIDTH != 1) && (LASSO_HOST_UNALIGNED_MEMORY_ACCESS == 0)
+    uint8_t* crcp = (uint8_t*)&crc;
+    uint32_t cnt;
+#endif
 
 #if (LASSO_HOST_CRC_BYTEWIDTH == 1)
     *buffer = (uint8_t)crc;
@@ -447,7 +1029,6 @@ static void lasso_hostAppendCRC (
     #if (LASSO_HOST_UNALIGNED_MEMORY_ACCESS == 1)
         *(uint16_t*)buffer = (uint16_t)crc;
     #else
-        uint8_t* crcp = (uint8_t*)&crc;
         cnt = 2;
         while (cnt--) {
             *buffer++ = *crcp++;
@@ -457,9 +1038,8 @@ static void lasso_hostAppendCRC (
     #if (LASSO_HOST_UNALIGNED_MEMORY_ACCESS == 1)
         *(uint32_t*)buffer = crc;
     #else
-        uint8_t* crcp = (uint8_t*)&crc;
-        numBytes = 4;
-        while (numBytes--) {
+        cnt = 4;
+        while (cnt--) {
             *buffer++ = *crcp++;
         }
     #endif
@@ -471,138 +1051,921 @@ static void lasso_hostAppendCRC (
 
 
 /*!
- *  \brief Fetches data from underlying memory cells of active data cell set.
- *
- *         For registered and active data cells, this function fetches the
- *         underlying memory cell values and places them in the strobe buffer.
- *         Depending on the Byte width of memory cells, they are copied either
- *         in 1-Byte, 2-Byte or 4-Byte operations. However, on systems where
- *         unaligned 2-Byte or 4-Byte accesses are invalid, only 1-Byte access
- *         is used in copy operations.
- *         If message pack encoding is selected for host responses, the strobe
- *         packet is signalled by a invalid message pack Byte in the first Byte
- *         location of the buffer.
- *         If CRC calculation is selected, the user-supplied function computes
- *         CRC over all Bytes placed in the buffer. The CRC is appended last.
+ *  \brief  Append CRC to end of response or strobe frame.
  *
  *  \return Void
-*/
-static void lasso_hostSampleDataCells (void) {
-#if (LASSO_HOST_STROBE_EXTERNAL_SOURCE == 0)
-    uint8_t* dataSpaceBufferPtr = strobe.buffer;
-    dataCell* dC = dataCellFirst;
-    uint16_t ctrl;
-    uint16_t count;
-    const void* ptr;
-#if (LASSO_HOST_UNALIGNED_MEMORY_ACCESS == 0)
+ */
+#if (LASSO_HOST_COMMAND_CRC_ENABLE == 1) || (LASSO_HOST_STROBE_CRC_ENABLE == 1)
+static void lasso_hostAppendCRC (
+    lasso_host_t* lh,                       //!< Lasso host instance
+    uint8_t* buffer,                        //!< buffer start pointer
+    uint32_t cnt                            //!< number of Bytes to iterate over
+) {
+    lasso_hostWriteCRC(buffer + cnt, lasso_hostComputeCRC(lh, buffer, cnt));
+}
+#endif
+
+
+/*!
+ *  \brief  Copy aligned 32-bit words of memory cell(s) to strobe buffer.
+ *
+ *          The source must be LongWord-aligned, the destination may have any
+ *          alignment. If both are mutually aligned, words are moved directly.
+ *          Otherwise, the first and last word are written Byte by Byte and the
+ *          aligned words in between are merged from two adjacent source words
+ *          (shift-merge), such that only aligned 32-bit loads and stores are
+ *          performed. Each source word is read exactly once.
+ *
+ *  \return Strobe buffer pointer behind copied Bytes
+ */
+#if (LASSO_HOST_STROBE_EXTERNAL_SOURCE == 0) && (LASSO_HOST_STROBE_SCATTER_GATHER == 0) && \
+    (LASSO_HOST_STROBE_MSGPACK == 0) && (LASSO_HOST_UNALIGNED_MEMORY_ACCESS == 0)
+static uint8_t* lasso_hostCopyWords (
+    uint8_t* dest,                          //!< strobe buffer pointer
+    const uint32_t* src,                    //!< LongWord-aligned source pointer
+    uint32_t words                          //!< number of 32-bit words (> 0)
+) {
+    uint32_t k = (uint32_t)((uintptr_t)dest & 3);   // destination misalignment
+    uint32_t prev, next;
+    uint32_t* d;
     union {
         uint32_t m32;
-        uint16_t m16[2];
         uint8_t m8[4];
     } atom __attribute__((aligned(4)));
-#endif
-#if (LASSO_HOST_STROBE_DYNAMICS == LASSO_STROBE_DYNAMIC)
-    uint8_t* dataCellMaskPtr;
-    uint8_t dataCellMaskBit;
-#endif
 
-#if (LASSO_HOST_STROBE_ENCODING == LASSO_ENCODING_COBS)
-    *dataSpaceBufferPtr = 0xFF; // indicate that buffer has not been COBS en-
-                                // coded yet, COBS itself places a 0x00 here
-    dataSpaceBufferPtr += 2;    // access space behind COBS header
-#endif
+    if (k == 0) {
+        d = (uint32_t*)dest;
+        while (words--) {
+            *d++ = *src++;
+        }
+        return (uint8_t*)d;
+    }
 
-#if (LASSO_HOST_STROBE_ENCODING == LASSO_ENCODING_ESCS)
-    *dataSpaceBufferPtr = 0x00; // indicate that buffer has not been ESCS en-
-                                // coded yet, ESCS itself places a 0x7E here
-    dataSpaceBufferPtr += strobe.Bytes_max, // access 2nd half of buffer
-#endif
+    // head: write first (4 - k) Bytes of first word to reach alignment
+    atom.m32 = prev = *src++;
+    for (next = 0; next < 4 - k; next++) {
+        *dest++ = atom.m8[next];
+    }
 
-#if (LASSO_HOST_STROBE_ENCODING == LASSO_ENCODING_COBS) || \
-    (LASSO_HOST_STROBE_ENCODING == LASSO_ENCODING_ESCS)
-    // write "invalid" MessagePack code to strobe buffer, such that
-    // client understands that data is strobe and not response data
-    *dataSpaceBufferPtr++ = LASSO_HOST_INVALID_MSGPACK_CODE;
+    // middle: merge remaining k Bytes of previous with (4 - k) Bytes of next word
+    d = (uint32_t*)dest;
+    while (--words) {
+        next = *src++;
+    #if (LASSO_HOST_LITTLE_ENDIAN == 1)
+        *d++ = (prev >> ((4 - k) << 3)) | (next << (k << 3));
+    #else
+        *d++ = (prev << ((4 - k) << 3)) | (next >> (k << 3));
+    #endif
+        prev = next;
+    }
+
+    // tail: write remaining k Bytes of last word
+    dest = (uint8_t*)d;
+    atom.m32 = prev;
+    for (next = 4 - k; next < 4; next++) {
+        *dest++ = atom.m8[next];
+    }
+
+    return dest;
+}
 #endif
 
-#if (LASSO_HOST_STROBE_DYNAMICS == LASSO_STROBE_DYNAMIC)
-    // initialize mask pointer and index
-    dataCellMaskPtr = dataSpaceBufferPtr;
-    dataCellMaskBit = 1;
 
-    // clear mask Bytes
-    for (dataCellMaskBit = 0; dataCellMaskBit < dataCellMaskBytes; dataCellMaskBit++) {
-        *dataSpaceBufferPtr++ = 0;
-    }
+/*!
+ *  \brief  Copy underlying memory cell(s) to strobe buffer.
+ *
+ *          Memory cells are read in their atomic Byte width (1-Byte, 2-Byte
+ *          or 4-Byte operations, 8-Byte types are read as two 4-Byte parts),
+ *          such that values are never torn by concurrent updates. On systems
+ *          where unaligned 2-Byte or 4-Byte accesses are invalid, arrays of
+ *          LASSO_HOST_BULK_COPY_MIN_BYTES or more are moved as 32-bit words
+ *          (see lasso_hostCopyWords()), an unaligned 2-Byte head or tail
+ *          element is copied separately. Smaller cells are written Byte by
+ *          Byte. Large cells may be handed to a user-supplied memory-to-memory
+ *          copy (DMA), see lasso_hostRegisterMEMCPY().
+ *          Host endianness is maintained.
+ *
+ *  \return Strobe buffer pointer behind copied Bytes
+ */
+#if (LASSO_HOST_STROBE_EXTERNAL_SOURCE == 0) && (LASSO_HOST_STROBE_SCATTER_GATHER == 0) && \
+    (LASSO_HOST_STROBE_MSGPACK == 0)
+static uint8_t* lasso_hostCopyCell (
+    lasso_host_t* lh,                       //!< Lasso host instance
+    uint8_t* dest,                          //!< strobe buffer pointer
+    const void* src,                        //!< memory cell pointer
+    uint32_t Bytes,                         //!< number of Bytes to copy
+    uint32_t width                          //!< Byte width of memory cell type
+) {
+#if (LASSO_HOST_UNALIGNED_MEMORY_ACCESS == 0)
+    union {
+        uint32_t m32;
+        uint16_t m16[2];
+        uint8_t m8[4];
+    } atom __attribute__((aligned(4)));
 #endif
 
-    while (dC) {
-        ctrl = dC->ctrl;
-        if (ctrl & LASSO_DATACELL_STROBE) {
-#if (LASSO_HOST_STROBE_DYNAMICS == LASSO_STROBE_DYNAMIC)
-            if ((--dC->update_rate & 0xFFFF) == 0) {
-                *dataCellMaskPtr |= dataCellMaskBit;        // set mask bit
-                dC->update_rate += (dC->update_rate >> 16); // reload
+#if (LASSO_HOST_MEMCPY_MIN_BYTES == 0)
+    (void)lh;                           // instance only needed for the MEMCPY callback
 #else
-            {
+    // DMA is only requested when it can preserve atomic access, i.e. for
+    // 1-Byte types or when pointers and length are all LongWord-aligned
+    if (lh->memcpyCallback && (Bytes >= LASSO_HOST_MEMCPY_MIN_BYTES)) {
+        if ((width == 1) || ((((uintptr_t)dest | (uintptr_t)src | Bytes) & 3) == 0)) {
+            if (lh->memcpyCallback(dest, src, Bytes) == 0) {
+                return dest + Bytes;
+            }
+        }
+    }
 #endif
-                count = dC->count;
-                ptr = dC->ptr;
 
-                switch (ctrl & LASSO_DATACELL_BYTEWIDTH_MASK) {
-                    case LASSO_DATACELL_BYTEWIDTH_1 : {
-                        while(count--) {
-                            *dataSpaceBufferPtr++ = *(uint8_t*)ptr;
-                            ptr = (uint8_t*)ptr + 1;
-                        }
-                        break;
-                    }
-                    case LASSO_DATACELL_BYTEWIDTH_2 : {
+    switch (width) {
+        case 1 : {
+            memcpy((void*)dest, src, Bytes);
+            dest += Bytes;
+            break;
+        }
+        case 2 : {
+#if (LASSO_HOST_UNALIGNED_MEMORY_ACCESS == 0)
+            if (Bytes >= LASSO_HOST_BULK_COPY_MIN_BYTES) {
+                // head: single element to reach LongWord-aligned source
+                if ((uintptr_t)src & 2) {
+                    atom.m16[0] = *(const uint16_t*)src;
+                    src = (const uint16_t*)src + 1;
+                    *dest++ = atom.m8[0];
+                    *dest++ = atom.m8[1];
+                    Bytes -= 2;
+                }
+                dest = lasso_hostCopyWords(dest, (const uint32_t*)src, Bytes >> 2);
+                src = (const uint8_t*)src + (Bytes & ~3UL);
+                Bytes &= 3;                 // tail: 0 or 1 element left
+            }
+#endif
+            Bytes >>= 1;
 #if (LASSO_HOST_UNALIGNED_MEMORY_ACCESS == 1)
-                        while(count--) {
-                            *(uint16_t*)dataSpaceBufferPtr++ = *(uint16_t*)ptr;
-                            ptr = (uint16_t*)ptr + 1;
-                        }
+            while (Bytes--) {
+                *(uint16_t*)dest = *(const uint16_t*)src;
+                src = (const uint16_t*)src + 1;
+                dest += 2;
+            }
 #else
-                        // 1) perform atomic reads (possible since Word-aligned)
-                        // 2) perform Byte-aligned writes
-                        // Note: host endianness is maintained
-                        while(count--) {
-                            atom.m16[0] = *(uint16_t*)ptr;
-                            ptr = (uint16_t*)ptr + 1;
-                            *dataSpaceBufferPtr++ = atom.m8[0];
-                            *dataSpaceBufferPtr++ = atom.m8[1];
-                        }
+            // 1) perform atomic reads (possible since Word-aligned)
+            // 2) perform Byte-aligned writes
+            while (Bytes--) {
+                atom.m16[0] = *(const uint16_t*)src;
+                src = (const uint16_t*)src + 1;
+                *dest++ = atom.m8[0];
+                *dest++ = atom.m8[1];
+            }
 #endif
-                        break;
-                    }
-                    case LASSO_DATACELL_BYTEWIDTH_4 : {
+            break;
+        }
+        default : {
+            Bytes >>= 2;
 #if (LASSO_HOST_UNALIGNED_MEMORY_ACCESS == 1)
-                        while(count--) {
-                            *(uint32_t*)dataSpaceBufferPtr++ = *(uint32_t*)ptr;
-                            ptr = (uint32_t*)ptr + 1;
-                        }
+            while (Bytes--) {
+                *(uint32_t*)dest = *(const uint32_t*)src;
+                src = (const uint32_t*)src + 1;
+                dest += 4;
+            }
 #else
-                        // 1) perform atomic reads (possible since LongWord-aligned)
-                        // 2) perform Byte-aligned writes
-                        // Note: host endianness is maintained
-                        while(count--) {
-                            atom.m32 = *(uint32_t*)ptr;
-                            ptr = (uint32_t*)ptr + 1;
-                            *dataSpaceBufferPtr++ = atom.m8[0];
-                            *dataSpaceBufferPtr++ = atom.m8[1];
-                            *dataSpaceBufferPtr++ = atom.m8[2];
-                            *dataSpaceBufferPtr++ = atom.m8[3];
-                        }
+            if ((Bytes << 2) >= LASSO_HOST_BULK_COPY_MIN_BYTES) {
+                dest = lasso_hostCopyWords(dest, (const uint32_t*)src, Bytes);
+                break;
+            }
+
+            // 1) perform atomic reads (possible since LongWord-aligned)
+            // 2) perform Byte-aligned writes
+            while (Bytes--) {
+                atom.m32 = *(const uint32_t*)src;
+                src = (const uint32_t*)src + 1;
+                *dest++ = atom.m8[0];
+                *dest++ = atom.m8[1];
+                *dest++ = atom.m8[2];
+                *dest++ = atom.m8[3];
+            }
 #endif
-                        break;
-                    }
-                    default : {}
+        }
+    }
+
+    return dest;
+}
+#endif
+
+
+/*!
+ *  \brief  Build flat strobe copy plan from active data cell set.
+ *
+ *          Each active data cell becomes one copy operation (source pointer,
+ *          Byte count, Byte width). Data cells whose memory cells are adjacent
+ *          and have the same Byte width are merged into a single operation.
+ *          The sampler then runs this plan instead of walking the dataCell
+ *          list and decoding each data cell's control code.
+ *          With LASSO_HOST_STROBE_ALIGN, the data cells are visited widest
+ *          Byte width first (one pass per width), see lasso_hostAlignedBytepos().
+ *
+ *          Must be rebuilt whenever membership of the active data cell set
+ *          changes (strobing must be off at that time).
+ *
+ *  \return Void
+ */
+#if (LASSO_HOST_STROBE_COPY_PLAN == 1)
+static void lasso_hostBuildCopyPlan (
+    lasso_host_t* lh            //!< Lasso host instance
+) {
+    dataCell* dC;
+    copyOp* op = lh->copyPlan;
+    uint32_t width;
+#if (LASSO_HOST_STROBE_ALIGN == 1)
+    uint32_t align;
+#endif
+
+    lh->copyPlanOps = 0;
+
+#if (LASSO_HOST_STROBE_ALIGN == 1)
+    for (align = 8; align > 0; align >>= 1) {
+    dC = lh->dataCellFirst;
+    while (dC) {
+        width = LASSO_DATACELL_BYTEWIDTH(dC->ctrl);
+        if (LASSO_CELL_ACTIVE(dC) && (width == align)) {
+#else
+    dC = lh->dataCellFirst;
+    while (dC) {
+        if (LASSO_CELL_ACTIVE(dC)) {
+            width = LASSO_DATACELL_BYTEWIDTH(dC->ctrl);
+#endif
+
+            if ((lh->copyPlanOps > 0) &&
+                (op->width == width) &&
+                ((const uint8_t*)op->src + op->Bytes == (const uint8_t*)dC->ptr)) {
+                op->Bytes += (uint32_t)dC->count * width;   // merge with previous
+            }
+            else {
+                if (lh->copyPlanOps > 0) {
+                    op++;
+                }
+                op->src   = dC->ptr;
+                op->Bytes = (uint32_t)dC->count * width;
+                op->width = width;
+                lh->copyPlanOps++;
+            }
+        }
+        dC = LASSO_CELL_NEXT(dC);
+    }
+#if (LASSO_HOST_STROBE_ALIGN == 1)
+    }
+#endif
+}
+#endif
+
+
+/*!
+ *  \brief  Build scatter-gather segment list from active data cell set.
+ *
+ *          Each active data cell becomes one segment pointing directly to its
+ *          underlying memory cell(s). Data cells whose memory cells are adja-
+ *          cent are merged into a single segment.
+ *          With LASSO_HOST_STROBE_ALIGN, the data cells are visited widest
+ *          Byte width first (one pass per width), see lasso_hostAlignedBytepos().
+ *
+ *          Must be rebuilt whenever membership of the active data cell set
+ *          changes (strobing must be off at that time).
+ *
+ *  \return Void
+ */
+#if (LASSO_HOST_STROBE_SCATTER_GATHER == 1)
+static void lasso_hostBuildSegments (
+    lasso_host_t* lh            //!< Lasso host instance
+) {
+    dataCell* dC;
+    lasso_segment* seg = lh->strobeSegments;
+    uint32_t Bytes;
+#if (LASSO_HOST_STROBE_ALIGN == 1)
+    uint32_t align;
+#endif
+
+    lh->strobeSegmentCount = 0;
+
+#if (LASSO_HOST_STROBE_ALIGN == 1)
+    for (align = 8; align > 0; align >>= 1) {
+    dC = lh->dataCellFirst;
+    while (dC) {
+        if (LASSO_CELL_ACTIVE(dC) && (LASSO_DATACELL_BYTEWIDTH(dC->ctrl) == align)) {
+#else
+    dC = lh->dataCellFirst;
+    while (dC) {
+        if (LASSO_CELL_ACTIVE(dC)) {
+#endif
+            Bytes = (uint32_t)dC->count * LASSO_DATACELL_BYTEWIDTH(dC->ctrl);
+
+            if ((lh->strobeSegmentCount > 0) &&
+                (seg->ptr + seg->len == (const uint8_t*)dC->ptr)) {
+                seg->len += Bytes;          // merge with previous
+            }
+            else {
+                if (lh->strobeSegmentCount > 0) {
+                    seg++;
                 }
+                seg->ptr = (const uint8_t*)dC->ptr;
+                seg->len = Bytes;
+                lh->strobeSegmentCount++;
+            }
+        }
+        dC = LASSO_CELL_NEXT(dC);
+    }
+#if (LASSO_HOST_STROBE_ALIGN == 1)
+    }
+#endif
+}
+#endif
+
+
+/*!
+ *  \brief  Number of Bytes a data cell occupies in the strobe frame.
+ *
+ *  \return Strobe Bytes of data cell (when active)
+ */
+static uint32_t lasso_hostStrobeBytes (
+    const dataCell* dC                      //!< pointer to data cell
+) {
+#if (LASSO_HOST_STROBE_MSGPACK == 1)
+    return dC->packHeaderBytes + (uint32_t)dC->count * dC->packElementBytes;
+#else
+    return (uint32_t)dC->count * LASSO_DATACELL_BYTEWIDTH(dC->ctrl);
+#endif
+}
+
+
+/*!
+ *  \brief  Build msgpack templates of all data cells.
+ *
+ *          A data cell is packed as a scalar, as an array of its elements
+ *          (count > 1) or as raw bytes (char). Elements use fixed-width
+ *          msgpack codes, such that the packed size of a data cell is known
+ *          beforehand and the header (array or raw length) never changes.
+ *          The sampler then only puts the values behind the headers.
+ *
+ *          Strobe Byte counts are converted from raw to packed sizes.
+ *
+ *  \return Void
+ */
+#if (LASSO_HOST_STROBE_MSGPACK == 1)
+static void lasso_hostBuildPackTemplates (
+    lasso_host_t* lh            //!< Lasso host instance
+) {
+    dataCell* dC = lh->dataCellFirst;
+    struct S_PackWriter writer;
+    uint32_t width;
+    T_PackType type;
+
+    while (dC) {
+        width = LASSO_DATACELL_BYTEWIDTH(dC->ctrl);
+        lh->strobe.Bytes_max -= (uint32_t)dC->count * width;
+        if (LASSO_CELL_ACTIVE(dC)) {
+            lh->strobe.Bytes_total -= (uint32_t)dC->count * width;
+        }
+
+        switch (dC->ctrl & LASSO_DATACELL_TYPE_MASK) {
+            case (LASSO_BOOL & LASSO_DATACELL_TYPE_MASK)  : type = E_PackTypeBoolean; break;
+            case (LASSO_CHAR & LASSO_DATACELL_TYPE_MASK)  : type = E_PackTypeRawBytes; break;
+            case (LASSO_UINT8 & LASSO_DATACELL_TYPE_MASK) : type = E_PackTypeUnsignedInteger; break;
+            case (LASSO_INT8 & LASSO_DATACELL_TYPE_MASK)  : type = E_PackTypeSignedInteger; break;
+            default                                       : type = E_PackTypeFloat; break;
+        }
+
+        PackWriterSetBuffer(&writer, dC->packHeader, sizeof(dC->packHeader));
+        if (type == E_PackTypeRawBytes) {
+            PackWriterOpenRawBytes(&writer, dC->count);
+            dC->packCode = 0;
+            dC->packElementBytes = 1;
+        }
+        else {
+            if (dC->count > 1) {
+                PackWriterOpen(&writer, E_PackTypeArray, dC->count);
+            }
+            dC->packCode = PackGetFixedCode(type, width);
+            dC->packElementBytes = (type == E_PackTypeBoolean) ? 1 : 1 + width;
+        }
+        dC->packHeaderBytes = (uint8_t)PackWriterGetOffset(&writer);
+
+        lh->strobe.Bytes_max += lasso_hostStrobeBytes(dC);
+        if (LASSO_CELL_ACTIVE(dC)) {
+            lh->strobe.Bytes_total += lasso_hostStrobeBytes(dC);
+        }
+
+        dC = LASSO_CELL_NEXT(dC);
+    }
+
+    lh->strobe.Bytes_max += sizeof(lh->packFrameHeader);    // worst case
+}
+
+
+/*!
+ *  \brief  Build msgpack array header of strobe from active data cell set.
+ *
+ *          Must be rebuilt whenever membership of the active data cell set
+ *          changes (strobing must be off at that time).
+ *
+ *  \return Void
+ */
+static void lasso_hostBuildPackFrame (
+    lasso_host_t* lh            //!< Lasso host instance
+) {
+    dataCell* dC = lh->dataCellFirst;
+    struct S_PackWriter writer;
+    uint32_t active = 0;
+
+    while (dC) {
+        if (LASSO_CELL_ACTIVE(dC)) {
+            active++;
+        }
+        dC = LASSO_CELL_NEXT(dC);
+    }
+
+    lh->strobe.Bytes_total -= lh->packFrameHeaderBytes;
+
+    PackWriterSetBuffer(&writer, lh->packFrameHeader, sizeof(lh->packFrameHeader));
+    PackWriterOpen(&writer, E_PackTypeArray, active);
+    lh->packFrameHeaderBytes = (uint8_t)PackWriterGetOffset(&writer);
+
+    lh->strobe.Bytes_total += lh->packFrameHeaderBytes;
+}
+#endif
+
+
+/*!
+ *  \brief  Hash of a sampled memory cell or name string (FNV-1a, 32 bit).
+ *
+ *          Used by delta strobing to detect changed memory cells. A hash
+ *          collision delays the update of a cell until the next keyframe.
+ *          Also used by the datacell index to locate data cells by name.
+ *
+ *  \return 32-bit hash value
+ */
+#if (LASSO_HOST_STROBE_DYNAMICS == LASSO_STROBE_DELTA) || \
+    (LASSO_HOST_DATACELL_INDEX == 1)
+static uint32_t lasso_hostHashCell (
+    const uint8_t* src,                     //!< sampled memory cell or string
+    uint32_t cnt                            //!< number of Bytes
+) {
+    uint32_t hash = 2166136261UL;
+
+    while (cnt--) {
+        hash ^= *src++;
+        hash *= 16777619UL;
+    }
+
+    return hash;
+}
+#endif
+
+
+/*!
+ *  \brief  Compress sampled strobe payload in place.
+ *
+ *          1) XOR-delta: each Byte is XOR'ed with the same Byte of the
+ *             previous strobe, keyframes carry raw values (slowly varying
+ *             values turn into mostly zero Bytes)
+ *          2) byte planes: Byte k of each LASSO_HOST_STROBE_COMPRESS_STRIDE
+ *             sized word is moved to plane k (trailing Bytes of an incomplete
+ *             word are appended last), such that unchanged high-order Bytes
+ *             of consecutive values line up as runs of zeros
+ *          3) zero run-length coding: code 0x80 + (n - 2) stands for n = 2...129
+ *             zero Bytes, code n - 1 is followed by n = 1...128 literal Bytes
+ *
+ *          The compressed payload starts with a header Byte (1 = keyframe,
+ *          0 = delta to previous strobe). The client reverts the steps in
+ *          reverse order, the payload layout follows from the active data
+ *          cells. Any strobe selection change forces a keyframe.
+ *
+ *  \return Pointer behind compressed payload
+ */
+#if (LASSO_HOST_STROBE_COMPRESS == 1)
+static uint8_t* lasso_hostCompressStrobe (
+    lasso_host_t* lh,                       //!< Lasso host instance
+    uint8_t* payload,                       //!< sampled payload (replaced by compressed payload)
+    uint32_t size,                          //!< number of sampled Bytes
+    bool keyframe                           //!< send raw values?
+) {
+    uint8_t* ref = lh->compressRef;
+    uint8_t* tmp = lh->compressTmp;
+    uint8_t* code;
+    uint32_t words = size / LASSO_HOST_STROBE_COMPRESS_STRIDE;
+    uint32_t i, k, n;
+
+    // 1) and 2): XOR-delta into byte planes, update reference
+    for (i = 0; i < words; i++) {
+        for (k = 0; k < LASSO_HOST_STROBE_COMPRESS_STRIDE; k++) {
+            n = i * LASSO_HOST_STROBE_COMPRESS_STRIDE + k;
+            tmp[k * words + i] = keyframe ? payload[n] : (payload[n] ^ ref[n]);
+            ref[n] = payload[n];
+        }
+    }
+    for (n = words * LASSO_HOST_STROBE_COMPRESS_STRIDE; n < size; n++) {
+        tmp[n] = keyframe ? payload[n] : (payload[n] ^ ref[n]);
+        ref[n] = payload[n];
+    }
+
+    // 3) zero run-length coding back into strobe buffer
+    *payload++ = keyframe ? 1 : 0;
+    i = 0;
+    while (i < size) {
+        for (n = 0; (i + n < size) && (n < 129) && (tmp[i + n] == 0); n++);
+        if (n >= 2) {
+            *payload++ = (uint8_t)(0x80 + n - 2);
+            i += n;
+        }
+        else {
+            // literals up to the next run of (at least) two zero Bytes
+            code = payload++;
+            for (n = 0; (i < size) && (n < 128); n++) {
+                if ((tmp[i] == 0) && (i + 1 < size) && (tmp[i + 1] == 0)) {
+                    break;
+                }
+                *payload++ = tmp[i++];
+            }
+            *code = (uint8_t)(n - 1);
+        }
+    }
+
+    return payload;
+}
+#endif
+
+
+/*!
+ *  \brief  Fetch next due cell from the rate group lists.
+ *
+ *          Each rate group list is ordered by registration index, so picking
+ *          the lowest index among the heads of all due groups yields the due
+ *          cells in mask order. Cost per cell is bounded by the number of due
+ *          groups, cells of groups that are not due are never visited.
+ *
+ *  \return Pointer to next due data cell, NULL if none left
+ */
+#if (LASSO_HOST_STROBE_RATE_GROUPS == 1)
+static dataCell* lasso_hostNextRateGroupCell (
+    dataCell** head,                        //!< current head of each rate group
+    uint16_t* due                           //!< bitmap of due groups with cells left
+) {
+    dataCell* dC = NULL;
+    uint16_t bits = *due;
+    uint8_t k, sel = 0;
+
+    for (k = 0; bits; k++, bits >>= 1) {
+        if ((bits & 1) && ((dC == NULL) || (head[k]->index < dC->index))) {
+            dC = head[k];
+            sel = k;
+        }
+    }
+
+    if (dC) {
+        head[sel] = dC->groupNext;
+        if (head[sel] == NULL) {
+            *due &= ~(1 << sel);            // group exhausted
+        }
+    }
+
+    return dC;
+}
+#endif
+
+
+/*!
+ *  \brief  Read user-supplied hardware timer.
+ *
+ *          With LASSO_HOST_TIMESTAMP_64BIT, timer wrap-arounds are counted
+ *          in the upper 32 bits. The timer must therefore be read at least
+ *          once per wrap period (lasso_hostHandleCOM() does so every tick).
+ *
+ *  \return Timer count (wrap-extended)
+ */
+#if (LASSO_HOST_TIMESTAMP_TIMER == 1)
+static lasso_timestamp_t lasso_hostReadTimer (
+    lasso_host_t* lh            //!< Lasso host instance
+) {
+    uint32_t now = lh->timerCallback();
+
+#if (LASSO_HOST_TIMESTAMP_64BIT == 1)
+    if (now < lh->timerLast) {
+        lh->timerWraps++;
+    }
+    lh->timerLast = now;
+
+    return ((uint64_t)lh->timerWraps << 32) | now;
+#else
+    return now;
+#endif
+}
+
+
+/*!
+ *  \brief  Latch timestamp data cell at the start of a strobe.
+ *
+ *          Without a registered timer, the timestamp keeps counting ticks.
+ *
+ *  \return Void
+ */
+static void lasso_hostLatchTimestamp (
+    lasso_host_t* lh            //!< Lasso host instance
+) {
+    if (lh->timerCallback) {
+        lh->lasso_timestamp = lasso_hostReadTimer(lh);
+    }
+}
+#endif
+
+
+/*!
+ *  \brief  Store cycles elapsed since start in last/max performance counters.
+ *
+ *  \return Void
+ */
+#if (LASSO_HOST_PERF_COUNTERS == 1)
+static void lasso_hostPerfCycles (
+    lasso_host_t* lh,                       //!< Lasso host instance
+    uint8_t idx,                            //!< LASSO_PERF_xxx_CYCLES
+    uint32_t start                          //!< LASSO_HOST_PERF_CYCLES() at start
+) {
+    uint32_t cycles = (uint32_t)LASSO_HOST_PERF_CYCLES() - start;
+
+    lh->perf[idx] = cycles;
+    if (cycles > lh->perf[idx + 1]) {
+        lh->perf[idx + 1] = cycles;
+    }
+}
+#endif
+
+
+/*!
+ *  \brief Fetches data from underlying memory cells of active data cell set.
+ *
+ *         For registered and active data cells, this function fetches the
+ *         underlying memory cell values and places them in the strobe buffer.
+ *         Depending on the Byte width of memory cells, they are copied either
+ *         in 1-Byte, 2-Byte or 4-Byte operations. However, on systems where
+ *         unaligned 2-Byte or 4-Byte accesses are invalid, only 1-Byte access
+ *         is used in write operations (see lasso_hostCopyCell()).
+ *         With LASSO_HOST_STROBE_COPY_PLAN, a precompiled copy plan is run
+ *         instead of walking the list of data cells.
+ *         With LASSO_HOST_STROBE_MSGPACK, the active data cells are packed
+ *         as a msgpack array (big-endian values, self-describing types).
+ *         With LASSO_STROBE_DELTA, each due memory cell is sampled and hashed,
+ *         and dropped again from the strobe if its hash matches the value last
+ *         transmitted (except in keyframes).
+ *         With LASSO_HOST_STROBE_COMPRESS, the sampled payload is compressed
+ *         before CRC generation (see lasso_hostCompressStrobe()).
+ *         If message pack encoding is selected for host responses, the strobe
+ *         packet is signalled by a invalid message pack Byte in the first Byte
+ *         location of the buffer.
+ *         If CRC calculation is selected, the user-supplied function computes
+ *         CRC over all Bytes placed in the buffer. The CRC is appended last.
+ *
+ *  \return Void
+*/
+#if (LASSO_HOST_STROBE_SCATTER_GATHER == 0)
+static void lasso_hostSampleDataCells (
+    lasso_host_t* lh            //!< Lasso host instance
+) {
+#if (LASSO_HOST_PERF_COUNTERS == 1)
+    uint32_t cycles = LASSO_HOST_PERF_CYCLES();
+#endif
+#if (LASSO_HOST_STROBE_EXTERNAL_SOURCE == 0)
+    uint8_t* dataSpaceBufferPtr = lh->strobe.buffer;
+#if (LASSO_HOST_STROBE_COPY_PLAN == 1)
+    const copyOp* op = lh->copyPlan;
+    uint8_t n = lh->copyPlanOps;
+#else
+    dataCell* dC = lh->dataCellFirst;
+#if (LASSO_HOST_STROBE_MSGPACK == 0)
+    uint16_t ctrl;
+#endif
+#endif
+#if (LASSO_HOST_STROBE_MSGPACK == 1)
+    struct S_PackWriter writer;
+    uint8_t n;
+#endif
+#if (LASSO_HOST_STROBE_DYNAMICS != LASSO_STROBE_STATIC)
+    uint8_t* dataCellMaskPtr;
+    uint8_t dataCellMaskBit;
+#endif
+#if (LASSO_HOST_STROBE_RATE_GROUPS == 1)
+    dataCell* groupHead[LASSO_RATE_GROUPS];
+    uint8_t* dataCellMaskBase;
+    uint16_t due;
+    uint8_t k;
+#endif
+#if (LASSO_HOST_STROBE_DYNAMICS == LASSO_STROBE_DELTA)
+    uint8_t* cellStart;
+    uint32_t cellHash;
+    bool cellDue;
+#endif
+#if (LASSO_HOST_STROBE_COMPRESS == 1)
+    uint8_t* payloadStart;
+#endif
+#if (LASSO_STROBE_CRC_INLINE == 1)
+    uint8_t* crcStart;
+    uint32_t crc = 0;
+#endif
+#if (LASSO_HOST_SNAPSHOT == 1)
+    uint8_t* snapshotStart;
+    uint32_t seq;
+    uint8_t retries = LASSO_HOST_SNAPSHOT_RETRIES;
+#endif
+#if (LASSO_HOST_STROBE_DYNAMICS == LASSO_STROBE_DELTA) || (LASSO_HOST_STROBE_COMPRESS == 1)
+    bool keyframe = (lh->strobeKeyframeCountdown == 0);
+
+    if (keyframe) {
+        lh->strobeKeyframeCountdown = LASSO_HOST_STROBE_KEYFRAME_PERIOD;
+    }
+    lh->strobeKeyframeCountdown--;
+#endif
+
+#if (LASSO_HOST_TIMESTAMP_TIMER == 1)
+    lasso_hostLatchTimestamp(lh);
+#endif
+
+#if (LASSO_HOST_STROBE_ENCODING == LASSO_ENCODING_COBS)
+    *dataSpaceBufferPtr = 0xFF; // indicate that buffer has not been COBS en-
+                                // coded yet, COBS itself places a 0x00 here
+    dataSpaceBufferPtr += LASSO_COBS_OFFSET(lh->strobe); // access space behind COBS header
+#endif
+
+#if (LASSO_HOST_STROBE_ENCODING == LASSO_ENCODING_ESCS)
+    *dataSpaceBufferPtr = 0x00; // indicate that buffer has not been ESCS en-
+                                // coded yet, ESCS itself places a 0x7E here
+    dataSpaceBufferPtr += LASSO_ESCS_OFFSET(lh->strobe),    // access 2nd half of buffer
+#endif
+
+#if (LASSO_HOST_STROBE_ENCODING == LASSO_ENCODING_COBS) || \
+    (LASSO_HOST_STROBE_ENCODING == LASSO_ENCODING_ESCS)
+    // write "invalid" MessagePack code to strobe buffer, such that
+    // client understands that data is strobe and not response data
+    *dataSpaceBufferPtr++ = LASSO_HOST_INVALID_MSGPACK_CODE;
+#endif
+
+#if (LASSO_HOST_STROBE_DYNAMICS != LASSO_STROBE_STATIC)
+    // initialize mask pointer
+    dataCellMaskPtr = dataSpaceBufferPtr;
+
+    // clear mask Bytes
+    for (dataCellMaskBit = 0; dataCellMaskBit < lh->dataCellMaskBytes; dataCellMaskBit++) {
+        *dataSpaceBufferPtr++ = 0;
+    }
+
+    // initialize mask index (after clearing, loop above reuses it)
+    dataCellMaskBit = 1;
+#endif
+
+#if (LASSO_HOST_STROBE_COMPRESS == 1)
+    payloadStart = dataSpaceBufferPtr;
+#endif
+
+#if (LASSO_HOST_STROBE_RATE_GROUPS == 1)
+    dataCellMaskBase = dataCellMaskPtr;
+
+    // select due rate groups: group k is due every 2^k strobes
+    #if (LASSO_HOST_STROBE_DYNAMICS == LASSO_STROBE_DELTA)
+    if (keyframe || (lh->strobeCycle == 0)) {
+    #else
+    if (lh->strobeCycle == 0) {
+    #endif
+        due = lh->rateGroupUsed;
+    }
+    else {
+        due = lh->rateGroupUsed & (((lh->strobeCycle & (~lh->strobeCycle + 1)) << 1) - 1);
+    }
+    lh->strobeCycle++;
+
+    for (k = 0; k < LASSO_RATE_GROUPS; k++) {
+        groupHead[k] = lh->rateGroupFirst[k];
+    }
+#endif
+
+#if (LASSO_HOST_SNAPSHOT == 1)
+    // seqlock: re-copy data cells if a publisher was active at start, or has
+    // completed an update meanwhile (see lasso_hostPublishBegin())
+    snapshotStart = dataSpaceBufferPtr;
+    do {
+        seq = lh->snapshotSeq;
+        LASSO_HOST_BARRIER();   // version read before data cells are read
+        dataSpaceBufferPtr = snapshotStart;
+    #if (LASSO_STROBE_CRC_INLINE == 1)
+        crc = 0;
+    #endif
+    #if (LASSO_HOST_STROBE_COPY_PLAN == 1)
+        op = lh->copyPlan;
+        n = lh->copyPlanOps;
+    #else
+        dC = lh->dataCellFirst;
+    #endif
+#endif
+
+#if (LASSO_HOST_STROBE_MSGPACK == 1)
+    // self-describing strobe: array of active data cells, values are put
+    // behind precomputed headers (see lasso_hostBuildPackTemplates())
+    for (n = 0; n < lh->packFrameHeaderBytes; n++) {
+        *dataSpaceBufferPtr++ = lh->packFrameHeader[n];
+    }
+    PackWriterSetBuffer(&writer, dataSpaceBufferPtr, lh->strobe.Bytes_max);
+
+    while (dC) {
+        if (LASSO_CELL_ACTIVE(dC)) {
+            for (n = 0; n < dC->packHeaderBytes; n++) {
+                *writer.cursor++ = dC->packHeader[n];
+            }
+            if (dC->packCode) {
+                PackWriterPutFixedUnchecked(&writer, dC->packCode, dC->ptr,
+                                            LASSO_DATACELL_BYTEWIDTH(dC->ctrl), dC->count);
+            }
+            else {
+                memcpy(writer.cursor, dC->ptr, dC->count);
+                writer.cursor += dC->count;
             }
         }
-        dC = dC->next;
+        dC = LASSO_CELL_NEXT(dC);
+    }
+    dataSpaceBufferPtr = writer.cursor;
+#elif (LASSO_HOST_STROBE_COPY_PLAN == 1)
+    // run precompiled copy plan (static strobing only, see lasso_hostBuildCopyPlan())
+    while (n--) {
+    #if (LASSO_STROBE_CRC_INLINE == 1)
+        crcStart = dataSpaceBufferPtr;
+    #endif
+        dataSpaceBufferPtr = lasso_hostCopyCell(lh, dataSpaceBufferPtr, op->src, op->Bytes, op->width);
+    #if (LASSO_STROBE_CRC_INLINE == 1)
+        if (lh->crcUpdateCallback) {
+            crc = lh->crcUpdateCallback(crc, crcStart, dataSpaceBufferPtr - crcStart);
+        }
+    #endif
+        op++;
+    }
+#else
+#if (LASSO_HOST_STROBE_RATE_GROUPS == 1)
+    // visit due cells only, merged back into registration (mask) order
+    while ((dC = lasso_hostNextRateGroupCell(groupHead, &due)) != NULL) {
+        dataCellMaskPtr = dataCellMaskBase + (dC->index >> 3);
+        dataCellMaskBit = 1 << (dC->index & 7);
+#else
+    while (dC) {
+#endif
+        ctrl = dC->ctrl;
+        if (LASSO_CELL_ACTIVE(dC)) {
+#if (LASSO_HOST_STROBE_DYNAMICS == LASSO_STROBE_DELTA)
+    #if (LASSO_HOST_STROBE_RATE_GROUPS == 1)
+            cellDue = true;
+    #else
+            cellDue = LASSO_CELL_COUNTDOWN(dC);
+            if (cellDue) {
+                LASSO_CELL_RELOAD(dC);
+            }
+    #endif
+            if (cellDue || keyframe) {
+                cellStart = dataSpaceBufferPtr;
+                dataSpaceBufferPtr = lasso_hostCopyCell(lh, dataSpaceBufferPtr,
+                                                        dC->ptr,
+                                                        (uint32_t)dC->count * LASSO_DATACELL_BYTEWIDTH(ctrl),
+                                                        LASSO_DATACELL_BYTEWIDTH(ctrl));
+                cellHash = lasso_hostHashCell(cellStart, dataSpaceBufferPtr - cellStart);
+                if (keyframe || (cellHash != dC->hash)) {
+                    *dataCellMaskPtr |= dataCellMaskBit;    // set mask bit
+                    dC->hash = cellHash;
+                }
+                else {
+                    dataSpaceBufferPtr = cellStart;         // unchanged, drop cell
+                }
+            }
+#else
 #if (LASSO_HOST_STROBE_DYNAMICS == LASSO_STROBE_DYNAMIC)
+    #if (LASSO_HOST_STROBE_RATE_GROUPS == 1)
+            {
+                *dataCellMaskPtr |= dataCellMaskBit;        // set mask bit
+    #else
+            if (LASSO_CELL_COUNTDOWN(dC)) {
+                *dataCellMaskPtr |= dataCellMaskBit;        // set mask bit
+                LASSO_CELL_RELOAD(dC);
+    #endif
+#else
+            {
+#endif
+            #if (LASSO_STROBE_CRC_INLINE == 1)
+                crcStart = dataSpaceBufferPtr;
+            #endif
+                dataSpaceBufferPtr = lasso_hostCopyCell(lh, dataSpaceBufferPtr,
+                                                        dC->ptr,
+                                                        (uint32_t)dC->count * LASSO_DATACELL_BYTEWIDTH(ctrl),
+                                                        LASSO_DATACELL_BYTEWIDTH(ctrl));
+            #if (LASSO_STROBE_CRC_INLINE == 1)
+                if (lh->crcUpdateCallback) {
+                    crc = lh->crcUpdateCallback(crc, crcStart, dataSpaceBufferPtr - crcStart);
+                }
+            #endif
+            }
+#endif
+        }
+#if (LASSO_HOST_STROBE_RATE_GROUPS == 0)
+        dC = LASSO_CELL_NEXT(dC);
+#endif
+#if (LASSO_HOST_STROBE_DYNAMICS != LASSO_STROBE_STATIC) && (LASSO_HOST_STROBE_RATE_GROUPS == 0)
         if (dataCellMaskBit == 0x80) {
             dataCellMaskPtr++;
             dataCellMaskBit = 1;
@@ -610,35 +1973,266 @@ static void lasso_hostSampleDataCells (void) {
         else {
             dataCellMaskBit <<= 1;
         }
-#endif
+#endif
+    }
+#endif
+
+#if (LASSO_HOST_SNAPSHOT == 1)
+        LASSO_HOST_BARRIER();   // data cells read before version is re-read
+    } while (((seq & 0xFFFF) || (seq != lh->snapshotSeq)) && retries--);
+#endif
+#if (LASSO_HOST_STROBE_COMPRESS == 1)
+    dataSpaceBufferPtr = lasso_hostCompressStrobe(lh, payloadStart, dataSpaceBufferPtr - payloadStart, keyframe);
+#endif
+#if (LASSO_HOST_STROBE_DYNAMICS != LASSO_STROBE_STATIC) || (LASSO_HOST_STROBE_COMPRESS == 1)
+    #if (LASSO_HOST_STROBE_ENCODING == LASSO_ENCODING_COBS)
+        lh->strobe.Bytes_total = dataSpaceBufferPtr - lh->strobe.buffer - LASSO_COBS_OFFSET(lh->strobe);
+    #elif (LASSO_HOST_STROBE_ENCODING == LASSO_ENCODING_ESCS)
+        lh->strobe.Bytes_total = dataSpaceBufferPtr - lh->strobe.buffer - LASSO_ESCS_OFFSET(lh->strobe);
+    #endif
+    #if (LASSO_HOST_STROBE_CRC_ENABLE == 1)
+        lh->strobe.Bytes_total += LASSO_HOST_CRC_BYTEWIDTH;   // CRC appended below
+    #endif
+#endif
+
+#endif
+
+#if (LASSO_HOST_STROBE_CRC_ENABLE == 1)
+#if (LASSO_STROBE_CRC_INLINE == 1)
+    // CRC location directly follows last data cell
+    if (lh->crcUpdateCallback) {
+        lasso_hostWriteCRC(dataSpaceBufferPtr, crc);
+    }
+    else
+#endif
+    {
+#if (LASSO_HOST_STROBE_ENCODING == LASSO_ENCODING_ESCS)
+        lasso_hostAppendCRC(lh, lh->strobe.buffer + LASSO_ESCS_OFFSET(lh->strobe) + 1, lh->strobe.Bytes_total - LASSO_HOST_CRC_BYTEWIDTH - 1);
+#elif (LASSO_HOST_STROBE_ENCODING == LASSO_ENCODING_COBS)
+        lasso_hostAppendCRC(lh, lh->strobe.buffer + LASSO_COBS_OFFSET(lh->strobe) + 1, lh->strobe.Bytes_total - LASSO_HOST_CRC_BYTEWIDTH - 1);
+#else
+        lasso_hostAppendCRC(lh, lh->strobe.buffer, lh->strobe.Bytes_total - LASSO_HOST_CRC_BYTEWIDTH);
+#endif
+    }
+#endif
+
+#if (LASSO_HOST_PERF_COUNTERS == 1)
+    lh->perf[LASSO_PERF_STROBES]++;
+    lasso_hostPerfCycles(lh, LASSO_PERF_SAMPLE_CYCLES, cycles);
+#endif
+
+/* in RN mode: strobe frames must not be terminated! manual strobe capture! strobe encoding must be "NONE"!
+#if (LASSO_HOST_STROBE_ENCODING == LASSO_ENCODING_RN)
+    *dataSpaceBufferPtr++ = 0x13;   // '\r'
+    *dataSpaceBufferPtr   = 0x10;   // '\n'
+#endif
+*/
+}
+#endif
+
+
+/*!
+ *  \brief  Get first element of capture trigger data cell.
+ *
+ *  \return Value of data cell
+ */
+#if (LASSO_HOST_CAPTURE_SIZE > 0)
+static float lasso_hostCaptureValue (
+    const dataCell* dC                      //!< trigger data cell
+) {
+    switch (dC->ctrl & LASSO_DATACELL_TYPE_BYTEWIDTH_MASK) {
+        case LASSO_INT8:    return (float)*(int8_t*)dC->ptr;
+        case LASSO_UINT16:  return (float)*(uint16_t*)dC->ptr;
+        case LASSO_INT16:   return (float)*(int16_t*)dC->ptr;
+        case LASSO_UINT32:  return (float)*(uint32_t*)dC->ptr;
+        case LASSO_INT32:   return (float)*(int32_t*)dC->ptr;
+        case LASSO_FLOAT:   return *(float*)dC->ptr;
+        case LASSO_DOUBLE:  return (float)*(double*)dC->ptr;
+        default:            return (float)*(uint8_t*)dC->ptr;
+    }
+}
+
+
+/*!
+ *  \brief  Arm capture ring (oscilloscope mode).
+ *
+ *          The capture depth follows from the capture ring size and the
+ *          present strobe size. With a trigger data cell, the capture
+ *          triggers when the cell's (first) value rises through the level.
+ *          Otherwise, the user-supplied trigger callback decides (if none
+ *          is registered, the capture triggers immediately). Triggers are
+ *          ignored until the pre-trigger samples have been taken.
+ *
+ *  \return Error code
+ */
+static int32_t lasso_hostArmCapture (
+    lasso_host_t* lh,                       //!< Lasso host instance
+    uint32_t pre,                           //!< pre-trigger samples
+    dataCell* dC,                           //!< trigger data cell (or NULL)
+    int32_t level                           //!< trigger level
+) {
+    uint32_t depth;
+
+    if (lh->strobe.Bytes_total == 0) {
+        return EINVAL;
+    }
+
+    depth = LASSO_HOST_CAPTURE_SIZE / lh->strobe.Bytes_total;
+    if (depth > UINT16_MAX) {
+        depth = UINT16_MAX;
+    }
+    if (pre >= depth) {
+        return EINVAL;  // also if a single strobe exceeds capture ring
+    }
+
+    lh->captureDepth = (uint16_t)depth;
+    lh->capturePre   = (uint16_t)pre;
+    lh->capturePost  = (uint16_t)(depth - pre);
+    lh->captureHead  = 0;
+    lh->captureCount = 0;
+    lh->captureCell  = dC;
+    lh->captureLevel = (float)level;
+    if (dC) {
+        lh->captureLast = lasso_hostCaptureValue(dC);
+    }
+    lh->captureState = LASSO_CAPTURE_ARMED;
+
+    return 0;
+}
+
+
+/*!
+ *  \brief  Capture ring (oscilloscope mode) handler, called once per tick.
+ *
+ *          While armed or triggered, a strobe is sampled at every tick (in-
+ *          dependent of the strobe period) and its payload is stored in the
+ *          capture ring, overwriting the oldest sample. Once frozen, the ring
+ *          is sent oldest sample first as a burst of regular strobe frames,
+ *          one whenever the strobe frame is free.
+ *
+ *  \return Void
+ */
+static void lasso_hostCapture (
+    lasso_host_t* lh            //!< Lasso host instance
+) {
+    uint32_t bytes = lh->strobe.Bytes_total;
+    uint8_t* sample = lh->captureRing + (uint32_t)lh->captureHead * bytes;
+    uint8_t* payload = lh->strobe.buffer;
+    bool trigger;
+    float value;
+
+    if (!lh->strobe.permission) {
+        return;     // strobe frame still being transmitted
+    }
+
+#if (LASSO_HOST_STROBE_ENCODING == LASSO_ENCODING_COBS)
+    payload += LASSO_COBS_OFFSET(lh->strobe);
+#elif (LASSO_HOST_STROBE_ENCODING == LASSO_ENCODING_ESCS)
+    payload += LASSO_ESCS_OFFSET(lh->strobe);
+#endif
+
+    if (lh->captureState == LASSO_CAPTURE_READOUT) {
+    #if (LASSO_HOST_STROBE_ENCODING == LASSO_ENCODING_COBS)
+        lh->strobe.buffer[0] = 0xFF;    // not COBS encoded yet
+    #elif (LASSO_HOST_STROBE_ENCODING == LASSO_ENCODING_ESCS)
+        lh->strobe.buffer[0] = 0x00;    // not ESCS encoded yet
+    #endif
+        memcpy(payload, sample, bytes);
+
+        lh->strobe.frame = lh->strobe.buffer;       // load buffer start
+        lh->strobe.Byte_count = bytes;              // trigger transmission
+    #if (LASSO_HOST_STROBE_ENCODING == LASSO_ENCODING_COBS)
+        LASSO_COBS_PREPARE(lh->strobe);             // see LASSO_COBS_PREPARE()
+    #endif
+        lh->strobe.permission = false;              // lock strobe frame buffer
+
+        if (++lh->captureHead == lh->captureDepth) {
+            lh->captureHead = 0;
+        }
+        if (--lh->captureCount == 0) {
+            lh->captureState = LASSO_CAPTURE_IDLE;  // burst sent, resume strobing
+        }
+        return;
+    }
+
+    lasso_hostSampleDataCells(lh);
+    memcpy(sample, payload, bytes);
+
+    if (++lh->captureHead == lh->captureDepth) {
+        lh->captureHead = 0;
+    }
+    if (lh->captureCount < lh->captureDepth) {
+        lh->captureCount++;
+    }
+
+    if (lh->captureState == LASSO_CAPTURE_ARMED) {
+        if (lh->captureCell) {
+            value = lasso_hostCaptureValue(lh->captureCell);
+            trigger = (lh->captureLast < lh->captureLevel) && (value >= lh->captureLevel);
+            lh->captureLast = value;
+        }
+        else if (lh->trgCallback) {
+            trigger = lh->trgCallback();
+        }
+        else {
+            trigger = true;
+        }
+
+        // trigger sample is the first post-trigger sample
+        if (trigger && (lh->captureCount > lh->capturePre)) {
+            lh->captureState = LASSO_CAPTURE_POST;
+        }
     }
-#if (LASSO_HOST_STROBE_DYNAMICS == LASSO_STROBE_DYNAMIC)
-    #if (LASSO_HOST_STROBE_ENCODING == LASSO_ENCODING_COBS)
-        strobe.Bytes_total = dataSpaceBufferPtr - strobe.buffer - 2;
-    #elif (LASSO_HOST_STROBE_ENCODING == LASSO_ENCODING_ESCS)
-        strobe.Bytes_total = dataSpaceBufferPtr - strobe.buffer - strobe.Bytes_max;
-    #endif
-#endif
 
+    if (lh->captureState == LASSO_CAPTURE_POST) {
+        if (--lh->capturePost == 0) {
+            // ring is full, captureHead points to oldest sample
+            lh->captureState = LASSO_CAPTURE_READOUT;
+        }
+    }
+}
 #endif
 
-#if (LASSO_HOST_STROBE_CRC_ENABLE == 1)
-#if (LASSO_HOST_STROBE_ENCODING == LASSO_ENCODING_ESCS)
-    lasso_hostAppendCRC(strobe.buffer + strobe.Bytes_max + 1, strobe.Bytes_total - LASSO_HOST_CRC_BYTEWIDTH - 1);
-#elif (LASSO_HOST_STROBE_ENCODING == LASSO_ENCODING_COBS)
-    lasso_hostAppendCRC(strobe.buffer + 3, strobe.Bytes_total - LASSO_HOST_CRC_BYTEWIDTH - 1);
-#else
-    lasso_hostAppendCRC(strobe.buffer, strobe.Bytes_total - LASSO_HOST_CRC_BYTEWIDTH);
-#endif
-#endif
+/*!
+ *  \brief  Get Byte position of a data cell in the aligned strobe layout.
+ *
+ *          Active data cells are laid out widest Byte width first (8, 4, 2,
+ *          then 1-Byte types and strings), in registration order within each
+ *          width. Since every group's size is a multiple of its width, each
+ *          group starts at a multiple of the next narrower width and all data
+ *          cells end up naturally aligned relative to the strobe payload,
+ *          without padding Bytes. The strobe buffer is offset such that the
+ *          payload starts on a LASSO_MEMORY_ALIGN boundary in memory.
+ *
+ *  \return Byte position in strobe frame
+ */
+#if (LASSO_HOST_STROBE_ALIGN == 1) && (LASSO_HOST_DATACELL_INDEX == 0)
+static uint32_t lasso_hostAlignedBytepos (
+    lasso_host_t* lh,                       //!< Lasso host instance
+    const dataCell* target                  //!< pointer to data cell
+) {
+    dataCell* dC = lh->dataCellFirst;
+    uint32_t width = LASSO_DATACELL_BYTEWIDTH(target->ctrl);
+    uint32_t w, pos = 0;
+    bool before = true;                     // dC registered before target
 
-/* in RN mode: strobe frames must not be terminated! manual strobe capture! strobe encoding must be "NONE"!
-#if (LASSO_HOST_STROBE_ENCODING == LASSO_ENCODING_RN)
-    *dataSpaceBufferPtr++ = 0x13;   // '\r'
-    *dataSpaceBufferPtr   = 0x10;   // '\n'
-#endif
-*/
+    while (dC) {
+        if (dC == target) {
+            before = false;
+        }
+        else if (LASSO_CELL_ACTIVE(dC)) {
+            w = LASSO_DATACELL_BYTEWIDTH(dC->ctrl);
+            if ((w > width) || ((w == width) && before)) {
+                pos += lasso_hostStrobeBytes(dC);
+            }
+        }
+        dC = LASSO_CELL_NEXT(dC);
+    }
+
+    return pos;
 }
+#endif
+
 
 /*!
  *  \brief  Get data cell based on its registration order.
@@ -646,34 +2240,169 @@ static void lasso_hostSampleDataCells (void) {
  *  \return Pointer to dataCell
  */
 static dataCell* lasso_hostSeekDatacell (
+    lasso_host_t* lh,                       //!< Lasso host instance
     uint8_t num,                            //!< number in registration order
     uint32_t* bytepos                       //!< Byte position in strobe frame
 ) {
-    dataCell* dC = dataCellFirst;
-    uint16_t ctrl;
+#if (LASSO_HOST_DATACELL_INDEX == 1)
+    if ((lh->dataCellTable == NULL) || (num >= lh->dataCellCount)) {
+        return NULL;
+    }
+    *bytepos = lh->dataCellBytepos[num];
+
+    return lh->dataCellTable[num];
+#else
+    dataCell* dC = lh->dataCellFirst;
     uint32_t pos = 0;
 
     while (num && dC) {
-        ctrl = dC->ctrl;
-        if (ctrl & LASSO_DATACELL_STROBE) {
-            ctrl &= LASSO_DATACELL_BYTEWIDTH_MASK;
-            if (ctrl) {
-                pos += (uint32_t)dC->count * (uint32_t)ctrl;
-            }
-            else {
-                pos += dC->count;
-            }
+        if (LASSO_CELL_ACTIVE(dC)) {
+            pos += lasso_hostStrobeBytes(dC);
         }
 
         if (num) {
-            dC = dC->next;
+            dC = LASSO_CELL_NEXT(dC);
         }
         num--;
     }
+#if (LASSO_HOST_STROBE_ALIGN == 1)
+    if (dC) {
+        pos = lasso_hostAlignedBytepos(lh, dC);
+    }
+#endif
     *bytepos = pos;
 
     return dC;
+#endif
+}
+
+
+/*!
+ *  \brief  Update Byte positions of data cells in strobe frame.
+ *
+ *          Byte positions only depend on the set of active data cells, so
+ *          they are precomputed here instead of summed up on every seek.
+ *          With LASSO_HOST_STROBE_ALIGN, see lasso_hostAlignedBytepos().
+ *          Must be rerun whenever membership of the active data cell set
+ *          changes.
+ *
+ *  \return Void
+ */
+#if (LASSO_HOST_DATACELL_INDEX == 1)
+static void lasso_hostBuildBytepos (
+    lasso_host_t* lh            //!< Lasso host instance
+) {
+#if (LASSO_HOST_STROBE_ALIGN == 1)
+    uint32_t pos[4] = {0, 0, 0, 0};         // per Byte width rank
+    uint32_t start, Bytes;
+    uint8_t num, k;
+
+    // 1) sum up active Bytes per width, 2) widest group first
+    for (num = 0; num < lh->dataCellCount; num++) {
+        if (LASSO_CELL_ACTIVE(lh->dataCellTable[num])) {
+            pos[LASSO_BYTEWIDTH_RANK(LASSO_DATACELL_BYTEWIDTH(lh->dataCellTable[num]->ctrl))] +=
+                lasso_hostStrobeBytes(lh->dataCellTable[num]);
+        }
+    }
+    for (start = 0, k = 4; k > 0; k--) {
+        Bytes = pos[k - 1];
+        pos[k - 1] = start;
+        start += Bytes;
+    }
+
+    // 3) registration order within each width
+    for (num = 0; num < lh->dataCellCount; num++) {
+        k = LASSO_BYTEWIDTH_RANK(LASSO_DATACELL_BYTEWIDTH(lh->dataCellTable[num]->ctrl));
+        lh->dataCellBytepos[num] = pos[k];
+
+        if (LASSO_CELL_ACTIVE(lh->dataCellTable[num])) {
+            pos[k] += lasso_hostStrobeBytes(lh->dataCellTable[num]);
+        }
+    }
+#else
+    uint32_t pos = 0;
+    uint8_t num;
+
+    for (num = 0; num < lh->dataCellCount; num++) {
+        lh->dataCellBytepos[num] = pos;
+
+        if (LASSO_CELL_ACTIVE(lh->dataCellTable[num])) {
+            pos += lasso_hostStrobeBytes(lh->dataCellTable[num]);
+        }
+    }
+#endif
+}
+
+
+/*!
+ *  \brief  Build datacell index (registration order table and name table).
+ *
+ *          The name table is sorted by name hash (insertion sort, stable),
+ *          such that data cells with colliding name hashes resolve to the
+ *          one registered first.
+ *
+ *  \return Void
+ */
+static void lasso_hostBuildIndex (
+    lasso_host_t* lh            //!< Lasso host instance
+) {
+    dataCell* dC = lh->dataCellFirst;
+    nameEntry entry;
+    uint8_t num, i;
+
+    for (num = 0; dC && (num < lh->dataCellCount); num++) {
+        lh->dataCellTable[num] = dC;
+
+        entry.hash = lasso_hostHashCell((const uint8_t*)dC->name, strlen(dC->name));
+        entry.num = num;
+        for (i = num; (i > 0) && (lh->dataCellNames[i - 1].hash > entry.hash); i--) {
+            lh->dataCellNames[i] = lh->dataCellNames[i - 1];
+        }
+        lh->dataCellNames[i] = entry;
+
+        dC = LASSO_CELL_NEXT(dC);
+    }
+
+    lasso_hostBuildBytepos(lh);
+}
+
+
+/*!
+ *  \brief  Find data cell number by name hash (binary search).
+ *
+ *  \return Error code
+ */
+static int32_t lasso_hostFindDatacell (
+    lasso_host_t* lh,                       //!< Lasso host instance
+    uint32_t hash,                          //!< hash of data cell name
+    uint8_t* c                              //!< data cell number (output)
+) {
+    uint8_t lo = 0;
+    uint8_t hi = lh->dataCellCount;
+    uint8_t mid;
+
+    if (lh->dataCellNames == NULL) {
+        return EFAULT;
+    }
+
+    while (lo < hi) {
+        mid = lo + ((hi - lo) >> 1);
+        if (lh->dataCellNames[mid].hash < hash) {
+            lo = mid + 1;
+        }
+        else {
+            hi = mid;
+        }
+    }
+
+    if ((lo == lh->dataCellCount) || (lh->dataCellNames[lo].hash != hash)) {
+        return EFAULT;
+    }
+    *c = lh->dataCellNames[lo].num;
+
+    return 0;
 }
+#endif
 
 
 /*!
@@ -683,6 +2412,7 @@ static dataCell* lasso_hostSeekDatacell (
  */
 #if (LASSO_HOST_PROCESSING_MODE != LASSO_MSGPACK_MODE)
 static void lasso_copyDatacellParams (
+    lasso_host_t* lh,                   //!< Lasso host instance
     dataCell* dC,                       //!< pointer to data cell
     uint8_t** buffer,                   //!< pointer to output buffer pointer
     uint32_t bytepos                    //!< Byte position in strobe frame
@@ -690,23 +2420,25 @@ static void lasso_copyDatacellParams (
     char* dest = (char*)*buffer;
     uint32_t len;
 
+    (void)lh;                           // only read by LASSO_CELL_CTRL() with a static dataspace
+
 #if (LASSO_HOST_PROCESSING_MODE == LASSO_ASCII_MODE)
-    len = sprintf(dest, "%s,", dC->name);
+    len = LASSO_PRINT_STRING(dest, dC->name);
     dest += len;
 
-    len = sprintf(dest, "%u,", (unsigned short)dC->ctrl);
+    len = LASSO_PRINT_UINT32(dest, LASSO_CELL_CTRL(dC));
     dest += len;
 
-    len = sprintf(dest, "%u,", (unsigned short)dC->count);
+    len = LASSO_PRINT_UINT32(dest, dC->count);
     dest += len;
 
-    len = sprintf(dest, "%s,", dC->unit);
+    len = LASSO_PRINT_STRING(dest, dC->unit);
     dest += len;
 
-    len = sprintf(dest, "%lu,", (unsigned long)(dC->update_rate >> 16));
+    len = LASSO_PRINT_UINT32(dest, dC->update_rate >> 16);
     dest += len;
 
-    len = sprintf(dest, "%lu,", (unsigned long)bytepos);
+    len = LASSO_PRINT_UINT32(dest, bytepos);
     dest += len;;
 #else
     // future option?, to verify
@@ -772,7 +2504,7 @@ static int32_t lasso_copyDatacellValue (
 
 #if (LASSO_HOST_STROBE_EXTERNAL_SOURCE != 0)
     if (dC->ptr == NULL) {
-        len = sprintf(dest, "%hhu,", 0);
+        len = LASSO_PRINT_UINT32(dest, 0);
     }
     else {
 #endif
@@ -781,7 +2513,7 @@ static int32_t lasso_copyDatacellValue (
         case LASSO_BOOL:
         case LASSO_UINT8: {
 #if (LASSO_HOST_PROCESSING_MODE == LASSO_ASCII_MODE)
-            len = sprintf(dest, "%hhu,", *(unsigned char*)dC->ptr);
+            len = LASSO_PRINT_UINT32(dest, *(uint8_t*)dC->ptr);
 #else
             len = 1;
 #endif
@@ -789,7 +2521,7 @@ static int32_t lasso_copyDatacellValue (
         }
         case LASSO_INT8: {
 #if (LASSO_HOST_PROCESSING_MODE == LASSO_ASCII_MODE)
-            len = sprintf(dest, "%hhi,", *(signed char*)dC->ptr);
+            len = LASSO_PRINT_INT32(dest, *(int8_t*)dC->ptr);
 #else
             len = 1;
 #endif
@@ -798,10 +2530,10 @@ static int32_t lasso_copyDatacellValue (
         case LASSO_CHAR: {
 #if (LASSO_HOST_PROCESSING_MODE == LASSO_ASCII_MODE)
             if (dC->count == 1) {
-                len = sprintf(dest, "%c,", *(char*)dC->ptr);
+                len = LASSO_PRINT_CHAR(dest, *(char*)dC->ptr);
             }
             else {
-                len = sprintf(dest, "%s,", (char*)dC->ptr);
+                len = LASSO_PRINT_STRING(dest, (char*)dC->ptr);
             }
 #else
             len = strlen((const char*)(dC->ptr));
@@ -810,7 +2542,7 @@ static int32_t lasso_copyDatacellValue (
         }
         case LASSO_UINT16: {
 #if (LASSO_HOST_PROCESSING_MODE == LASSO_ASCII_MODE)
-            len = sprintf(dest, "%hu,", *(unsigned short*)dC->ptr);
+            len = LASSO_PRINT_UINT32(dest, *(uint16_t*)dC->ptr);
 #else
             len = 1;
 #endif
@@ -818,7 +2550,7 @@ static int32_t lasso_copyDatacellValue (
         }
         case LASSO_INT16: {
 #if (LASSO_HOST_PROCESSING_MODE == LASSO_ASCII_MODE)
-            len = sprintf(dest, "%hi,", *(signed short*)dC->ptr);
+            len = LASSO_PRINT_INT32(dest, *(int16_t*)dC->ptr);
 #else
             len = 2;
 #endif
@@ -826,7 +2558,7 @@ static int32_t lasso_copyDatacellValue (
         }
         case LASSO_UINT32: {
 #if (LASSO_HOST_PROCESSING_MODE == LASSO_ASCII_MODE)
-            len = sprintf(dest, "%lu,", *(unsigned long*)dC->ptr);
+            len = LASSO_PRINT_UINT32(dest, *(uint32_t*)dC->ptr);
 #else
             len = 4;
 #endif
@@ -834,7 +2566,7 @@ static int32_t lasso_copyDatacellValue (
         }
         case LASSO_INT32: {
 #if (LASSO_HOST_PROCESSING_MODE == LASSO_ASCII_MODE)
-            len = sprintf(dest, "%li,", *(signed long*)dC->ptr);
+            len = LASSO_PRINT_INT32(dest, *(int32_t*)dC->ptr);
 #else
             len = 4;
 #endif
@@ -842,7 +2574,7 @@ static int32_t lasso_copyDatacellValue (
         }
         case LASSO_FLOAT: {
 #if (LASSO_HOST_PROCESSING_MODE == LASSO_ASCII_MODE)
-            len = sprintf(dest, "%f,", *(float*)dC->ptr);
+            len = LASSO_PRINT_FLOAT(dest, *(float*)dC->ptr);
 #else
             len = 4;
 #endif
@@ -850,7 +2582,7 @@ static int32_t lasso_copyDatacellValue (
         }
         case LASSO_DOUBLE: {
 #if (LASSO_HOST_PROCESSING_MODE == LASSO_ASCII_MODE)
-            len = sprintf(dest, "%lf,", *(double*)dC->ptr);
+            len = LASSO_PRINT_DOUBLE(dest, *(double*)dC->ptr);
 #else
             len = 8;
 #endif
@@ -868,7 +2600,7 @@ static int32_t lasso_copyDatacellValue (
         *dest++ = *src++;
     }
 #else
-    dest += len; // "len" obtained with sprintf includes only data bytes, not NULL terminator !
+    dest += len; // "len" obtained with LASSO_PRINT includes only data bytes, not NULL terminator !
 #endif
 
     *buffer = (uint8_t*)dest;
@@ -889,14 +2621,14 @@ static int32_t lasso_hostGetDatacellNumber (
     const char* cp = (const char*)(*rb);
     uint32_t ui;
 #if (LASSO_HOST_PROCESSING_MODE == LASSO_ASCII_MODE)
-    if (sscanf(cp, "%lu", (unsigned long*)&ui) != 1) {
+    if (!LASSO_SCAN_UINT32(cp, &ui)) {
         return EINVAL;
     }
 
     // advance receiverBuffer (if more data follows after comma)
     *rb = (uint8_t*)strchr(cp, ',') + 1;
 
-    // return value read with sscanf
+    // return value read with LASSO_SCAN
     *c = (uint8_t)ui;
 #else
     // future option, to verify
@@ -908,6 +2640,37 @@ static int32_t lasso_hostGetDatacellNumber (
 }
 
 
+/*!
+ *  \brief  Get data cell number from name hash in string.
+ *
+ *  \return Error code.
+ */
+#if (LASSO_HOST_DATACELL_INDEX == 1) && (LASSO_HOST_PROCESSING_MODE != LASSO_MSGPACK_MODE)
+static int32_t lasso_hostGetDatacellHash (
+    lasso_host_t* lh,                       //!< Lasso host instance
+    uint8_t** rb,                           //!< source string pointer (modified by this function)
+    uint8_t* c                              //!< data cell number (output)
+) {
+    const char* cp = (const char*)(*rb);
+    uint32_t ui;
+#if (LASSO_HOST_PROCESSING_MODE == LASSO_ASCII_MODE)
+    if (!LASSO_SCAN_UINT32(cp, &ui)) {
+        return EINVAL;
+    }
+
+    // advance receiverBuffer (if more data follows after comma)
+    *rb = (uint8_t*)strchr(cp, ',') + 1;
+#else
+    // future option, to verify
+    memcpy(&ui, cp, sizeof(ui));
+    (*rb) += sizeof(ui);
+#endif
+
+    return lasso_hostFindDatacell(lh, ui, c);
+}
+#endif
+
+
 /*!
  *  \brief  Get strobe period from string.
  *
@@ -920,7 +2683,7 @@ static int32_t lasso_hostGetStrobePeriod (
     const char* cp = (const char*)(*rb);
     uint32_t ui;
 #if (LASSO_HOST_PROCESSING_MODE == LASSO_ASCII_MODE)
-    if (sscanf(cp, "%lu", (unsigned long*)&ui) != 1) {
+    if (!LASSO_SCAN_UINT32(cp, &ui)) {
         return EINVAL;
     }
 
@@ -932,7 +2695,7 @@ static int32_t lasso_hostGetStrobePeriod (
     *rb += 2;
 #endif
 
-    // return value read with sscanf
+    // return value read with LASSO_SCAN
     *c = (uint16_t)ui;
 
     return 0;
@@ -974,8 +2737,7 @@ static int32_t lasso_hostSetDatacellValue (
 #if (LASSO_HOST_PROCESSING_MODE == LASSO_MSGPACK_MODE)
             if (PackReaderGetUnsignedChar(frame_reader, &u)) {
 #elif (LASSO_HOST_PROCESSING_MODE == LASSO_ASCII_MODE)
-            //if (sscanf(cp, "%hhu", (unsigned char*)&u) != 1) {
-            if (sscanf(cp, "%lu", (unsigned long*)&u) != 1) {
+            if (!LASSO_SCAN_UINT32(cp, &u)) {
 #else
     // todo
 #endif
@@ -1041,8 +2803,7 @@ static int32_t lasso_hostSetDatacellValue (
 #if (LASSO_HOST_PROCESSING_MODE == LASSO_MSGPACK_MODE)
             if (PackReaderGetSignedChar(frame_reader, &i)) {
 #elif (LASSO_HOST_PROCESSING_MODE == LASSO_ASCII_MODE)
-            //if (sscanf(cp, "%hhi", (signed char*)&i) != 1) {
-            if (sscanf(cp, "%li", (signed long*)&i) != 1) {
+            if (!LASSO_SCAN_INT32(cp, &i)) {
 #else
     // todo
 #endif
@@ -1065,7 +2826,7 @@ static int32_t lasso_hostSetDatacellValue (
 #if (LASSO_HOST_PROCESSING_MODE == LASSO_MSGPACK_MODE)
             if (PackReaderGetUnsignedShort(frame_reader, &u)) {
 #elif (LASSO_HOST_PROCESSING_MODE == LASSO_ASCII_MODE)
-            if (sscanf(cp, "%hu", (unsigned short*)&u) != 1) {
+            if (!LASSO_SCAN_UINT16(cp, &u)) {
 #else
     // todo
 #endif
@@ -1087,7 +2848,7 @@ static int32_t lasso_hostSetDatacellValue (
 #if (LASSO_HOST_PROCESSING_MODE == LASSO_MSGPACK_MODE)
             if (PackReaderGetSignedShort(frame_reader, &i)) {
 #elif (LASSO_HOST_PROCESSING_MODE == LASSO_ASCII_MODE)
-            if (sscanf(cp, "%hi", &i) != 1) {
+            if (!LASSO_SCAN_INT16(cp, &i)) {
 #else
     // todo
 #endif
@@ -1108,7 +2869,7 @@ static int32_t lasso_hostSetDatacellValue (
 #if (LASSO_HOST_PROCESSING_MODE == LASSO_MSGPACK_MODE)
             if (PackReaderGetUnsignedLong(frame_reader, &u)) {
 #elif (LASSO_HOST_PROCESSING_MODE == LASSO_ASCII_MODE)
-            if (sscanf(cp, "%lu", (unsigned long*)&u) != 1) {
+            if (!LASSO_SCAN_UINT32(cp, &u)) {
 #else
     // todo
 #endif
@@ -1130,7 +2891,7 @@ static int32_t lasso_hostSetDatacellValue (
 #if (LASSO_HOST_PROCESSING_MODE == LASSO_MSGPACK_MODE)
             if (PackReaderGetSignedLong(frame_reader, &i)) {
 #elif (LASSO_HOST_PROCESSING_MODE == LASSO_ASCII_MODE)
-            if (sscanf(cp, "%li", (signed long*)&i) != 1) {
+            if (!LASSO_SCAN_INT32(cp, &i)) {
 #else
     // todo
 #endif
@@ -1155,7 +2916,7 @@ static int32_t lasso_hostSetDatacellValue (
             //if (PackReaderGetUnsignedInteger(frame_reader, &u))
             {
 #elif (LASSO_HOST_PROCESSING_MODE == LASSO_ASCII_MODE)
-            if (sscanf(cp, "%Lu", &u) != 1) {
+            if (!LASSO_SCAN_UINT64(cp, &u)) {
 #else
     // todo
 #endif
@@ -1179,7 +2940,7 @@ static int32_t lasso_hostSetDatacellValue (
             //if (PackReaderGetSignedInteger(frame_reader, &i))
             {
 #elif (LASSO_HOST_PROCESSING_MODE == LASSO_ASCII_MODE)
-            if (sscanf(cp, "%Li", &i) != 1) {
+            if (!LASSO_SCAN_INT64(cp, &i)) {
 #else
     // todo
 #endif
@@ -1205,7 +2966,7 @@ static int32_t lasso_hostSetDatacellValue (
             if (PackReaderGetFloat(frame_reader, &f)) {
 #elif (LASSO_HOST_PROCESSING_MODE == LASSO_ASCII_MODE)
             // endianness of host cpu unimportant since ascii-to-float conversion
-            if (sscanf(cp, "%f", &f) != 1) {
+            if (!LASSO_SCAN_FLOAT(cp, &f)) {
 #else
     // todo
 #endif
@@ -1229,7 +2990,7 @@ static int32_t lasso_hostSetDatacellValue (
             //if (PackReaderGetFloat(frame_reader, &f))
             {
 #elif (LASSO_HOST_PROCESSING_MODE == LASSO_ASCII_MODE)
-            if (sscanf(cp, "%lf", &d) != 1) {
+            if (!LASSO_SCAN_DOUBLE(cp, &d)) {
 #else
     // todo
 #endif
@@ -1259,23 +3020,126 @@ static int32_t lasso_hostSetDatacellValue (
  *
  *  \return Strobe margin in [1/100%]
  */
-static int32_t lasso_hostGetCycleMargin (void) {
-    float period_ms = (float)lasso_strobe_period * (float)lasso_tick_period;
+static int32_t lasso_hostGetCycleMargin (
+    lasso_host_t* lh            //!< Lasso host instance
+) {
+#if (LASSO_HOST_AUTOTUNE == 1)
+    if (lh->autotuneBusy) {     // measured rather than estimated from baudrate
+        return 10000 - (int32_t)lh->autotuneBusy * 10000 / lh->lasso_strobe_period;
+    }
+#endif
+
+    float period_ms = (float)lh->lasso_strobe_period * (float)lh->lasso_tick_period;
 #if (LASSO_HOST_STROBE_ENCODING == LASSO_ENCODING_ESCS)
-    float Bits_per_s = ((float)strobe.Bytes_total * 20000) / period_ms; // worst case ESCS overhead = 100%
+    float Bits_per_s = ((float)lh->strobe.Bytes_total * 20000) / period_ms; // worst case ESCS overhead = 100%
 #else
-    float Bits_per_s = ((float)strobe.Bytes_total * 10000) / period_ms; // all overhead included (COBS & NONE)
+    float Bits_per_s = ((float)lh->strobe.Bytes_total * 10000) / period_ms; // all overhead included (COBS & NONE)
 #endif
     return (int32_t)((LASSO_HOST_BAUDRATE - Bits_per_s) * 10000 / LASSO_HOST_BAUDRATE);
 }
 
 
+#if (LASSO_HOST_AUTOTUNE == 1)
+/*!
+ *  \brief  Restart strobe period autotuning (new period or strobing restarted).
+ *
+ *  \return Void
+ */
+static void lasso_hostAutotuneReset (
+    lasso_host_t* lh            //!< Lasso host instance
+) {
+    lh->autotuneFinished = false;
+    lh->autotuneBusy = 0;
+    lh->autotuneNeed = 0;
+    lh->autotuneCount = 0;
+}
+
+
+/*!
+ *  \brief  Apply strobe period chosen by autotuning.
+ *
+ *          The user may modify the period through perCallback, same as for
+ *          periods set by the Lasso client.
+ *
+ *  \return Void
+ */
+static void lasso_hostAutotuneApply (
+    lasso_host_t* lh,                       //!< Lasso host instance
+    uint16_t period                         //!< new strobe period in [ticks]
+) {
+    if (lh->perCallback) {
+        period = lh->perCallback(period);
+        if ((period < LASSO_HOST_STROBE_PERIOD_MIN_TICKS) || (period > LASSO_HOST_STROBE_PERIOD_MAX_TICKS)) {
+            return;
+        }
+    }
+    lh->lasso_strobe_period = period;
+}
+
+
+/*!
+ *  \brief  Adapt strobe period to measured serial link utilization.
+ *
+ *          Called when the next strobe is due. The transmission time of the
+ *          previous strobe is measured in ticks, from triggering its
+ *          transmission to the last call of lasso_hostSignalFinishedCOM().
+ *          - if the strobe period needed to stay below
+ *            LASSO_HOST_AUTOTUNE_UTILIZATION exceeds the current period, the
+ *            period is stretched right away
+ *          - otherwise, after LASSO_HOST_AUTOTUNE_WINDOW strobes, the period is
+ *            reduced to the largest one needed within that window, but not
+ *            below the period requested by the Lasso client
+ *
+ *  \return Void
+ */
+static void lasso_hostAutotune (
+    lasso_host_t* lh            //!< Lasso host instance
+) {
+    uint32_t need;
+
+    if (!lh->autotuneFinished) {
+        return;     // still transmitting (overdrive) or nothing sent yet
+    }
+    lh->autotuneFinished = false;
+
+    // rounded up: a transmission started and finished within one tick counts 1
+    lh->autotuneBusy = (uint16_t)(lh->autotuneDone - lh->autotuneStart) + 1;
+
+    need = ((uint32_t)lh->autotuneBusy * 100 + LASSO_HOST_AUTOTUNE_UTILIZATION - 1) / LASSO_HOST_AUTOTUNE_UTILIZATION;
+    if (need < lh->autotunePeriod) {
+        need = lh->autotunePeriod;
+    }
+    if (need > LASSO_HOST_STROBE_PERIOD_MAX_TICKS) {
+        need = LASSO_HOST_STROBE_PERIOD_MAX_TICKS;
+    }
+    if (need > lh->autotuneNeed) {
+        lh->autotuneNeed = (uint16_t)need;
+    }
+
+    if (need > lh->lasso_strobe_period) {
+        lasso_hostAutotuneApply(lh, (uint16_t)need);
+    }
+    else if (++lh->autotuneCount < LASSO_HOST_AUTOTUNE_WINDOW) {
+        return;
+    }
+    else if (lh->autotuneNeed < lh->lasso_strobe_period) {
+        lasso_hostAutotuneApply(lh, lh->autotuneNeed);
+    }
+
+    // start new window
+    lh->autotuneNeed = 0;
+    lh->autotuneCount = 0;
+}
+#endif
+
+
 /*!
  *  \brief  Read in command sent from client.
  *
  *  \return True if response must be sent to Lasso Client. False otherwise
  */
 static bool lasso_hostInterpreteCommand (
+    lasso_host_t* lh,           //!< Lasso host instance
     int32_t rx_err              //!< receive buffer overflow? incomplete command?
 ) {
     int32_t  msg_err = 0;       // error during message processing
@@ -1293,7 +3157,7 @@ static bool lasso_hostInterpreteCommand (
     dataCell* dC = NULL;
 
     bool tiny_reply = true;     // start by assumimg smallest possible reply
-    uint8_t* responseBuffer = response.buffer;
+    uint8_t* responseBuffer = lh->response.buffer;
 
 #if (LASSO_HOST_PROCESSING_MODE == LASSO_MSGPACK_MODE)
     struct S_PackWriter frame_writer;
@@ -1302,25 +3166,25 @@ static bool lasso_hostInterpreteCommand (
     uint32_t nargs;             // # of command arguments (incl. opcode)
                                 // ... and later number of opcode parameters
 #elif (LASSO_HOST_PROCESSING_MODE == LASSO_ASCII_MODE)
-    uint8_t* receiverBuffer = receiveBuffer;    // make local copy that can be modified
-    receiverBuffer[receiveValid] = 0;           // and terminate correctly
+    uint8_t* receiverBuffer = lh->commandBuffer;    // make local copy that can be modified
+    receiverBuffer[lh->commandValid] = 0;           // and terminate correctly
 #endif
 
-    if (cmdCallback) {
-        msg_err = cmdCallback(receiveBuffer, receiveValid);
+    if (lh->cmdCallback) {
+        msg_err = lh->cmdCallback(lh->commandBuffer, lh->commandValid);
     }
 
-    response.Bytes_total = 0;
+    lh->response.Bytes_total = 0;
 
 #if (LASSO_HOST_COMMAND_ENCODING == LASSO_ENCODING_COBS)
     *responseBuffer = 0xFF; // indicate that buffer has not been COBS en-
                             // coded yet, COBS itself places a 0x00 here
-    responseBuffer += 2;    // access space behind COBS header
+    responseBuffer += LASSO_COBS_OFFSET(lh->response);  // access space behind COBS header
 #endif
 
 #if (LASSO_HOST_COMMAND_ENCODING == LASSO_ENCODING_ESCS)
     *responseBuffer = 0;    // this will launch the ESCS encoder
-    responseBuffer += response.Bytes_max;   // access 2nd half of buffer
+    responseBuffer += LASSO_ESCS_OFFSET(lh->response);  // access 2nd half of buffer
 #endif
 
 #if (LASSO_HOST_COMMAND_CRC_ENABLE == 1)
@@ -1331,8 +3195,8 @@ static bool lasso_hostInterpreteCommand (
     // handle message
 #if (LASSO_HOST_PROCESSING_MODE == LASSO_MSGPACK_MODE)
     if (msg_err == 0) {
-        // setup msgpack reader on "receiveBuffer" with max length "receiveValid"
-        PackReaderSetBuffer(&frame_reader, receiveBuffer, receiveValid);
+        // setup msgpack reader on "commandBuffer" with max length "commandValid"
+        PackReaderSetBuffer(&frame_reader, lh->commandBuffer, lh->commandValid);
         PackReaderOpen(&frame_reader, E_PackTypeArray, &nargs);
 
         if (nargs > 0) {    // receive at least expected opcode
@@ -1363,13 +3227,8 @@ static bool lasso_hostInterpreteCommand (
 
 #elif (LASSO_HOST_PROCESSING_MODE == LASSO_ASCII_MODE)
     if (msg_err == 0) {
-        msg_err = sscanf((const char*)receiverBuffer++, "%c", &opcode);
-        if (msg_err == 1) { // received the expected opcode
-            msg_err = sprintf((char*)responseBuffer++, "%c", opcode);
-
-            if (msg_err == 1) {
-                msg_err = 0;
-            }
+        if (LASSO_SCAN_CHAR((const char*)receiverBuffer++, &opcode)) { // received the expected opcode
+            *responseBuffer++ = opcode;
         }
         else {
             opcode = LASSO_HOST_INVALID_OPCODE;
@@ -1396,24 +3255,70 @@ static bool lasso_hostInterpreteCommand (
         // - for GET command opcodes (>= 'a'), response & strobe interleaving is impossible
         // - for SET command opcodes (>= 'A'), each command deals with the issue differently
         #if (LASSO_HOST_STROBE_ENCODING < LASSO_ENCODING_COBS)
-            if ((lasso_strobing) && (opcode >= 'a')) {
+            if ((lh->lasso_strobing) && (opcode >= 'a')) {
                 return false;
             }
         #endif
 
             switch (opcode) {
                 // LASSO_HOST_GET_x functions
+            #if (LASSO_HOST_COMMAND_BATCH == 1)
+                case LASSO_HOST_GET_BATCH : {
+                    // acknowledgement is sent (tiny reply), followed by one
+                    // reply per sub-command, e.g. "bp0,32" = params of cells 0...31
+                    if (lh->batchRemaining > 0) {
+                        msg_err = EBUSY;
+                        break;
+                    }
+
+                    lparam = *receiverBuffer++;
+                    if ((lparam != LASSO_HOST_GET_DATACELL_PARAMS) &&
+                        (lparam != LASSO_HOST_GET_DATACELL_VALUE)) {
+                        msg_err = EINVAL;
+                        break;
+                    }
+                    if (strchr((const char*)receiverBuffer, ',') == NULL) {
+                        msg_err = EINVAL;   // count missing
+                        break;
+                    }
+
+                    msg_err = lasso_hostGetDatacellNumber(&receiverBuffer, &cparam);
+                    if (msg_err) break;
+                    if (!LASSO_SCAN_UINT16((char*)receiverBuffer, &sparam)) {
+                        msg_err = EINVAL;
+                        break;
+                    }
+                    if ((uint32_t)cparam + sparam > lh->dataCellCount) {
+                        msg_err = EFAULT;
+                        break;
+                    }
+
+                    lh->batchOpcode = (uint8_t)lparam;
+                    lh->batchNext = cparam;
+                    lh->batchRemaining = sparam;
+                    break;
+                }
+            #endif
+
                 case LASSO_HOST_GET_PROTOCOL_INFO : {
 
                 #if (LASSO_HOST_PROCESSING_MODE == LASSO_MSGPACK_MODE)
-                    PackWriterOpen(&frame_writer, E_PackTypeArray, 2);
+                    PackWriterOpen(&frame_writer, E_PackTypeArray, lasso_protocol_info_ext ? 3 : 2);
                     PackWriterPutUnsignedInteger(&frame_writer, lasso_protocol_info);
                     PackWriterPutString(&frame_writer, (char*)&lasso_version);
+                    if (lasso_protocol_info_ext) {
+                        PackWriterPutUnsignedInteger(&frame_writer, lasso_protocol_info_ext);
+                    }
                 #elif (LASSO_HOST_PROCESSING_MODE == LASSO_ASCII_MODE)
-                    msg_err = sprintf((char*)responseBuffer, "%lu,", (unsigned long)lasso_protocol_info);
+                    msg_err = LASSO_PRINT_UINT32((char*)responseBuffer, lasso_protocol_info);
                     if (msg_err > 0) {
                         responseBuffer += msg_err;
-                        msg_err = sprintf((char*)responseBuffer, "v%s,", TOSTR(LASSO_HOST_PROTOCOL_VERSION));
+                        *responseBuffer++ = 'v';
+                        msg_err = LASSO_PRINT_STRING((char*)responseBuffer, TOSTR(LASSO_HOST_PROTOCOL_VERSION));
+                    }
+                    if ((msg_err > 0) && (lasso_protocol_info_ext)) {
+                        responseBuffer += msg_err;
+                        msg_err = LASSO_PRINT_UINT32((char*)responseBuffer, lasso_protocol_info_ext);
                     }
                     if (msg_err > 0) {
                         responseBuffer += msg_err;
@@ -1439,39 +3344,39 @@ static bool lasso_hostInterpreteCommand (
 
                 #if (LASSO_HOST_PROCESSING_MODE == LASSO_MSGPACK_MODE)
                     PackWriterOpen(&frame_writer, E_PackTypeArray, 7);
-                    PackWriterPutUnsignedInteger(&frame_writer, (uint32_t)lasso_tick_period);
+                    PackWriterPutUnsignedInteger(&frame_writer, (uint32_t)lh->lasso_tick_period);
                     PackWriterPutUnsignedInteger(&frame_writer, (uint32_t)LASSO_HOST_COMMAND_TIMEOUT_TICKS);
-                    PackWriterPutUnsignedInteger(&frame_writer, (uint32_t)lasso_roundtrip_latency_ticks);
+                    PackWriterPutUnsignedInteger(&frame_writer, (uint32_t)lh->lasso_roundtrip_latency_ticks);
                     PackWriterPutUnsignedInteger(&frame_writer, (uint32_t)LASSO_HOST_STROBE_PERIOD_MIN_TICKS);
                     PackWriterPutUnsignedInteger(&frame_writer, (uint32_t)LASSO_HOST_STROBE_PERIOD_MAX_TICKS);
-                    PackWriterPutUnsignedInteger(&frame_writer, (uint32_t)lasso_strobe_period);
-                    PackWriterPutUnsignedInteger(&frame_writer, (uint32_t)lasso_hostGetCycleMargin());
+                    PackWriterPutUnsignedInteger(&frame_writer, (uint32_t)lh->lasso_strobe_period);
+                    PackWriterPutUnsignedInteger(&frame_writer, (uint32_t)lasso_hostGetCycleMargin(lh));
                 #elif (LASSO_HOST_PROCESSING_MODE == LASSO_ASCII_MODE)
-                    msg_err = sprintf((char*)responseBuffer, "%li,", (signed long)lasso_tick_period);
+                    msg_err = LASSO_PRINT_INT32((char*)responseBuffer, lh->lasso_tick_period);
                     if (msg_err > 0) {
                         responseBuffer += msg_err;
 
-                        msg_err = sprintf((char*)responseBuffer, "%li,", (signed long)LASSO_HOST_COMMAND_TIMEOUT_TICKS);
+                        msg_err = LASSO_PRINT_INT32((char*)responseBuffer, LASSO_HOST_COMMAND_TIMEOUT_TICKS);
                         if (msg_err > 0) {
                             responseBuffer += msg_err;
 
-                            msg_err = sprintf((char*)responseBuffer, "%li,", (signed long)lasso_roundtrip_latency_ticks);
+                            msg_err = LASSO_PRINT_INT32((char*)responseBuffer, lh->lasso_roundtrip_latency_ticks);
                             if (msg_err > 0) {
                                 responseBuffer += msg_err;
 
-                                msg_err = sprintf((char*)responseBuffer, "%li,", (signed long)LASSO_HOST_STROBE_PERIOD_MIN_TICKS);
+                                msg_err = LASSO_PRINT_INT32((char*)responseBuffer, LASSO_HOST_STROBE_PERIOD_MIN_TICKS);
                                 if (msg_err > 0) {
                                     responseBuffer += msg_err;
 
-                                    msg_err = sprintf((char*)responseBuffer, "%li,", (signed long)LASSO_HOST_STROBE_PERIOD_MAX_TICKS);
+                                    msg_err = LASSO_PRINT_INT32((char*)responseBuffer, LASSO_HOST_STROBE_PERIOD_MAX_TICKS);
                                     if (msg_err > 0) {
                                         responseBuffer += msg_err;
 
-                                        msg_err = sprintf((char*)responseBuffer, "%li,", (signed long)lasso_strobe_period);
+                                        msg_err = LASSO_PRINT_INT32((char*)responseBuffer, lh->lasso_strobe_period);
                                         if (msg_err > 0) {
                                             responseBuffer += msg_err;
 
-                                            msg_err = sprintf((char*)responseBuffer, "%li,", (signed long)lasso_hostGetCycleMargin());
+                                            msg_err = LASSO_PRINT_INT32((char*)responseBuffer, lasso_hostGetCycleMargin(lh));
                                         }
                                     }
                                 }
@@ -1499,9 +3404,9 @@ static bool lasso_hostInterpreteCommand (
 
                 #if (LASSO_HOST_PROCESSING_MODE == LASSO_MSGPACK_MODE)
                      PackWriterOpen(&frame_writer, E_PackTypeArray, 1);
-                     PackWriterPutUnsignedInteger(&frame_writer, (uint32_t)dataCellCount);
+                     PackWriterPutUnsignedInteger(&frame_writer, (uint32_t)lh->dataCellCount);
                 #elif (LASSO_HOST_PROCESSING_MODE == LASSO_ASCII_MODE)
-                    msg_err = sprintf((char*)responseBuffer, "%li,", (signed long)dataCellCount);
+                    msg_err = LASSO_PRINT_INT32((char*)responseBuffer, lh->dataCellCount);
                     if (msg_err > 0) {
                         responseBuffer += msg_err;
                         msg_err = 0;
@@ -1512,7 +3417,7 @@ static bool lasso_hostInterpreteCommand (
                     }
                 #else
                     // todo
-                    *responseBuffer++ = (uint8_t)dataCellCount;
+                    *responseBuffer++ = (uint8_t)lh->dataCellCount;
                 #endif
 
                     tiny_reply = false;
@@ -1528,7 +3433,7 @@ static bool lasso_hostInterpreteCommand (
                     msg_err = lasso_hostGetDatacellNumber(&receiverBuffer, &cparam);
                 #endif
                     if (msg_err) break;
-                    dC = lasso_hostSeekDatacell(cparam, &lparam);
+                    dC = lasso_hostSeekDatacell(lh, cparam, &lparam);
 
                     if (dC) {
                 #if (LASSO_HOST_PROCESSING_MODE == LASSO_MSGPACK_MODE)
@@ -1540,7 +3445,7 @@ static bool lasso_hostInterpreteCommand (
                         PackWriterPutUnsignedInteger(&frame_writer, dC->update_rate >> 16);
                         PackWriterPutUnsignedInteger(&frame_writer, lparam);
                 #else
-                        lasso_copyDatacellParams(dC, &responseBuffer, lparam);
+                        lasso_copyDatacellParams(lh, dC, &responseBuffer, lparam);
                 #endif
                     }
                     else {
@@ -1552,16 +3457,34 @@ static bool lasso_hostInterpreteCommand (
                     break;
                 }
 
+            #if (LASSO_HOST_DATACELL_INDEX == 1)
+                case LASSO_HOST_GET_DATACELL_VALUE_HASH :
+            #endif
                 case LASSO_HOST_GET_DATACELL_VALUE : {
 
+                #if (LASSO_HOST_DATACELL_INDEX == 1)
+                    if (opcode == LASSO_HOST_GET_DATACELL_VALUE_HASH) {
+                    #if (LASSO_HOST_PROCESSING_MODE == LASSO_MSGPACK_MODE)
+                        msg_err = PackReaderGetUnsignedInteger(&frame_reader, &lparam);
+                        if (msg_err == 0) {
+                            msg_err = lasso_hostFindDatacell(lh, lparam, &cparam);
+                        }
+                    #else
+                        msg_err = lasso_hostGetDatacellHash(lh, &receiverBuffer, &cparam);
+                    #endif
+                    }
+                    else
+                #endif
+                    {
                 #if (LASSO_HOST_PROCESSING_MODE == LASSO_MSGPACK_MODE)
-                    msg_err = PackReaderGetUnsignedInteger(&frame_reader, &lparam);
-                    cparam = (uint8_t)lparam;
+                        msg_err = PackReaderGetUnsignedInteger(&frame_reader, &lparam);
+                        cparam = (uint8_t)lparam;
                 #else
-                    msg_err = lasso_hostGetDatacellNumber(&receiverBuffer, &cparam);
+                        msg_err = lasso_hostGetDatacellNumber(&receiverBuffer, &cparam);
                 #endif
+                    }
                     if (msg_err) break;
-                    dC = lasso_hostSeekDatacell(cparam, &lparam);
+                    dC = lasso_hostSeekDatacell(lh, cparam, &lparam);
 
                     if (dC) {
                 #if (LASSO_HOST_PROCESSING_MODE == LASSO_MSGPACK_MODE)
@@ -1612,13 +3535,28 @@ static bool lasso_hostInterpreteCommand (
                 case LASSO_HOST_SET_ADVERTISE : {
                     // strobing on : this command does not send any reply, effect can easily be seen on client side
                     // strobing off: same
-                    lasso_advertise = true;
+                    lh->lasso_advertise = true;
+
+                #if (LASSO_HOST_CAPTURE_SIZE > 0)
+                    lh->captureState = LASSO_CAPTURE_IDLE;  // abort capture
+                #endif
+
+                #if (LASSO_HOST_STROBE_BUFFERS > 1)
+                    // drop strobes not yet transmitted
+                    lh->strobeRingHead = lh->strobeRingTail;
+                    if (lh->strobeRingBusy) {
+                        if (++lh->strobeRingHead == LASSO_HOST_STROBE_BUFFERS) {
+                            lh->strobeRingHead = 0;
+                        }
+                    }
+                    lh->strobeRingQueued = 0;
+                #endif
 
-                    if (lasso_strobing) {
-                        lasso_strobing = false;
+                    if (lh->lasso_strobing) {
+                        lh->lasso_strobing = false;
 
-                        if (actCallback) {
-                            actCallback(false);
+                        if (lh->actCallback) {
+                            lh->actCallback(false);
                         }
                     }
 
@@ -1644,92 +3582,202 @@ static bool lasso_hostInterpreteCommand (
                     // try to set new strobe period
                     if ((sparam >= LASSO_HOST_STROBE_PERIOD_MIN_TICKS) && (sparam <= LASSO_HOST_STROBE_PERIOD_MAX_TICKS)) {
                         //strobe_enable = true; // strobing not explicitly enabled here
-                        if (perCallback) {
-                            sparam = perCallback(sparam);
+                        if (lh->perCallback) {
+                            sparam = lh->perCallback(sparam);
                             if ((sparam >= LASSO_HOST_STROBE_PERIOD_MIN_TICKS) && (sparam <= LASSO_HOST_STROBE_PERIOD_MAX_TICKS)) {
-                                lasso_strobe_period = sparam;
+                                lh->lasso_strobe_period = sparam;
                             }
                         }
                         else {
-                            lasso_strobe_period = sparam;
+                            lh->lasso_strobe_period = sparam;
                         }
-                        if (strobe.countdown > lasso_strobe_period) {
-                            strobe.countdown = lasso_strobe_period;
+                        if (lh->strobe.countdown > lh->lasso_strobe_period) {
+                            lh->strobe.countdown = lh->lasso_strobe_period;
                         }
+                    #if (LASSO_HOST_AUTOTUNE == 1)
+                        lasso_hostAutotuneReset(lh);
+                        lh->autotunePeriod = lh->lasso_strobe_period;
+                    #endif
                     }
                     else {
                         msg_err = EINVAL;
                         break;
                     }
 
-                    if (lasso_advertise) {
+                    if (lh->lasso_advertise) {
                         return false;
                     }
 
                 #if (LASSO_HOST_STROBE_ENCODING < LASSO_ENCODING_COBS)  // no response & strobe interleaving possible
-                    if (lasso_strobing) {
+                    if (lh->lasso_strobing) {
                         return false;
                     }
-                #endif
+                #endif
+
+                    break;
+                }
+
+                case LASSO_HOST_SET_DATASPACE_STROBE : {
+                    // advertising on: no reply is sent
+                    // strobing on: tiny reply sent only for encodings COBS or ESCS
+                    // strobing off: tiny reply sent (acknowledgement)
+                    // Note: effect of this command can easily be observed on client side
+
+                    // get flag from command's parameter list
+                #if (LASSO_HOST_PROCESSING_MODE == LASSO_MSGPACK_MODE)
+                    msg_err = PackReaderGetUnsignedInteger(&frame_reader, &lparam);
+                #elif (LASSO_HOST_PROCESSING_MODE == LASSO_ASCII_MODE)
+                    if (!LASSO_SCAN_UINT32((const char*)receiverBuffer, &lparam)) {
+                        msg_err = EINVAL;
+                    }
+                #else
+                    lparam = *(uint32_t*)receiverBuffer;
+                #endif
+                    if (msg_err) break;
+
+                    // switch strobing on/off
+                    if (lparam) {
+                        if (!lh->lasso_strobing) {
+                            lh->strobe.countdown = 1;   // start strobing immediately
+
+                        #if (LASSO_HOST_AUTOTUNE == 1)
+                            lasso_hostAutotuneReset(lh);
+                        #endif
+
+                        #if (LASSO_HOST_STROBE_COPY_PLAN == 1)
+                            lasso_hostBuildCopyPlan(lh);
+                        #elif (LASSO_HOST_STROBE_SCATTER_GATHER == 1)
+                            lasso_hostBuildSegments(lh);
+                        #elif (LASSO_HOST_STROBE_DYNAMICS == LASSO_STROBE_DELTA)
+                            lh->strobeKeyframeCountdown = 0;    // start with keyframe
+                        #endif
+                        #if (LASSO_HOST_STROBE_COMPRESS == 1)
+                            lh->strobeKeyframeCountdown = 0;    // start with keyframe
+                        #endif
+                        }
+                        lh->lasso_strobing = true;
+                    }
+                    else {
+                        lh->lasso_strobing  = false;    // stop strobing on next cycle
+                    }
+
+                    if (lh->actCallback) {
+                        lh->actCallback(lh->lasso_strobing);
+                    }
+
+                    // also stop advertising, if necessary
+                    if (lh->lasso_advertise) {
+                        lh->strobe.Byte_count = 0;      // cancel remaining frames
+                        lh->lasso_advertise = false;
+                        return false;               // no response sent
+                    }
 
+                #if (LASSO_HOST_STROBE_ENCODING < LASSO_ENCODING_COBS)  // no response & strobe interleaving possible
+                    return false;
+                #else
                     break;
+                #endif
                 }
 
-                case LASSO_HOST_SET_DATASPACE_STROBE : {
+            #if (LASSO_HOST_CAPTURE_SIZE > 0)
+                case LASSO_HOST_SET_CAPTURE : {
                     // advertising on: no reply is sent
-                    // strobing on: tiny reply sent only for encodings COBS or ESCS
-                    // strobing off: tiny reply sent (acknowledgement)
-                    // Note: effect of this command can easily be observed on client side
+                    // otherwise: capture depth [samples] is sent, the burst
+                    // of strobe frames follows once the capture has triggered
+                    // parameters: pre-trigger samples [, trigger cell, level]
+                    int32_t level = 0;
+                    uint32_t bytepos;
 
-                    // get flag from command's parameter list
+                    bparam = false;     // trigger data cell given?
                 #if (LASSO_HOST_PROCESSING_MODE == LASSO_MSGPACK_MODE)
                     msg_err = PackReaderGetUnsignedInteger(&frame_reader, &lparam);
+                    if ((msg_err == 0) && (nargs > 1)) {
+                        msg_err = PackReaderGetUnsignedInteger(&frame_reader, &bytepos);
+                        cparam = (uint8_t)bytepos;
+                        if (msg_err == 0) {
+                            msg_err = PackReaderGetSignedInteger(&frame_reader, &level);
+                        }
+                        bparam = true;
+                    }
                 #elif (LASSO_HOST_PROCESSING_MODE == LASSO_ASCII_MODE)
-                    if (sscanf((const char*)receiverBuffer, "%lu", (unsigned long*)&lparam) != 1) {
+                    if (!LASSO_SCAN_UINT32((const char*)receiverBuffer, &lparam)) {
                         msg_err = EINVAL;
+                        break;
+                    }
+                    receiverBuffer = (uint8_t*)strchr((const char*)receiverBuffer, ',');
+                    if (receiverBuffer) {
+                        receiverBuffer++;
+                        if (strchr((const char*)receiverBuffer, ',') == NULL) {
+                            msg_err = EINVAL;   // level missing
+                            break;
+                        }
+                        msg_err = lasso_hostGetDatacellNumber(&receiverBuffer, &cparam);
+                        if ((msg_err == 0) && !LASSO_SCAN_INT32((const char*)receiverBuffer, &level)) {
+                            msg_err = EINVAL;
+                        }
+                        bparam = true;
                     }
                 #else
                     lparam = *(uint32_t*)receiverBuffer;
                 #endif
                     if (msg_err) break;
 
-                    // switch strobing on/off
-                    if (lparam) {
-                        if (!lasso_strobing) {
-                            strobe.countdown = 1;   // start strobing immediately
+                    dC = NULL;
+                    if (bparam) {
+                        dC = lasso_hostSeekDatacell(lh, cparam, &bytepos);
+                        if (dC == NULL) {
+                            msg_err = EFAULT;
+                            break;
                         }
-                        lasso_strobing = true;
-                    }
-                    else {
-                        lasso_strobing  = false;    // stop strobing on next cycle
                     }
 
-                    if (actCallback) {
-                        actCallback(lasso_strobing);
-                    }
+                    msg_err = lasso_hostArmCapture(lh, lparam, dC, level);
 
-                    // also stop advertising, if necessary
-                    if (lasso_advertise) {
-                        strobe.Byte_count = 0;      // cancel remaining frames
-                        lasso_advertise = false;
-                        return false;               // no response sent
+                    if (lh->lasso_advertise) {
+                        lh->captureState = LASSO_CAPTURE_IDLE;
+                        return false;
                     }
+                    if (msg_err) break;
 
-                #if (LASSO_HOST_STROBE_ENCODING < LASSO_ENCODING_COBS)  // no response & strobe interleaving possible
-                    return false;
+                #if (LASSO_HOST_PROCESSING_MODE == LASSO_MSGPACK_MODE)
+                    PackWriterOpen(&frame_writer, E_PackTypeArray, 1);
+                    PackWriterPutUnsignedInteger(&frame_writer, (uint32_t)lh->captureDepth);
+                #elif (LASSO_HOST_PROCESSING_MODE == LASSO_ASCII_MODE)
+                    msg_err = LASSO_PRINT_UINT32((char*)responseBuffer, lh->captureDepth);
+                    if (msg_err > 0) {
+                        responseBuffer += msg_err;
+                        msg_err = 0;
+                    }
+                    else {
+                        msg_err = ECANCELED;
+                        break;
+                    }
                 #else
-                    break;
+                    *(uint16_t*)responseBuffer = lh->captureDepth;
+                    responseBuffer += 2;
                 #endif
+
+                    tiny_reply = false;
+                    break;
                 }
+            #endif
 
                 case LASSO_HOST_SET_DATACELL_STROBE : {
                     // advertising on: no reply is sent
                     // strobing on : not possible -> this command requires strobing to be off since it changes the strobe length
                     // strobing off: acknowledgement is sent (tiny reply)
-                    if (lasso_strobing) {
+                    if (lh->lasso_strobing) {
                         return false;
                     }
 
+                #if (LASSO_HOST_CAPTURE_SIZE > 0)
+                    // capture samples have the size of the strobe
+                    if (lh->captureState != LASSO_CAPTURE_IDLE) {
+                        msg_err = EBUSY;
+                        break;
+                    }
+                #endif
+
                 #if (LASSO_HOST_PROCESSING_MODE == LASSO_MSGPACK_MODE)
                     msg_err = PackReaderGetUnsignedInteger(&frame_reader, &lparam);
                     cparam = (uint8_t)lparam;
@@ -1737,13 +3785,13 @@ static bool lasso_hostInterpreteCommand (
                     msg_err = lasso_hostGetDatacellNumber(&receiverBuffer, &cparam);
                 #endif
                     if (msg_err) break;
-                    dC = lasso_hostSeekDatacell(cparam, &lparam);
+                    dC = lasso_hostSeekDatacell(lh, cparam, &lparam);
 
                     if (dC) {
                 #if (LASSO_HOST_PROCESSING_MODE == LASSO_MSGPACK_MODE)
                         msg_err = PackReaderGetBoolean(&frame_reader, &bparam);
                 #elif (LASSO_HOST_PROCESSING_MODE == LASSO_ASCII_MODE)
-                        if (sscanf((char*)receiverBuffer, "%lu", (unsigned long*)&lparam) != 1) {
+                        if (!LASSO_SCAN_UINT32((char*)receiverBuffer, &lparam)) {
                             msg_err = EINVAL;
                         }
                         bparam = lparam != 0;
@@ -1752,53 +3800,79 @@ static bool lasso_hostInterpreteCommand (
                 #endif
                         if (msg_err) break;
 
-                        lparam = dC->ctrl & LASSO_DATACELL_ENABLE_MASK;
+                        lparam = LASSO_CELL_ACTIVE(dC);
                         if (bparam) {
                             if (!lparam) {
-                                lparam = (uint32_t)(dC->ctrl & LASSO_DATACELL_BYTEWIDTH_MASK);
-                                if (lparam == 0) {
-                                    lparam = 1;
-                                }
-                                strobe.Bytes_total += (uint32_t)dC->count * lparam;
-                                dC->ctrl |= LASSO_DATACELL_ENABLE_MASK;
+                                lh->strobe.Bytes_total += lasso_hostStrobeBytes(dC);
+                                LASSO_CELL_ACTIVATE(dC);
                             }
                         }
                         else {
                             if (lparam) {
-                                lparam = (uint32_t)(dC->ctrl & LASSO_DATACELL_BYTEWIDTH_MASK);
-                                if (lparam == 0) {
-                                    lparam = 1;
-                                }
-                                strobe.Bytes_total -= (uint32_t)dC->count * lparam;
-                                dC->ctrl &= LASSO_DATACELL_DISABLE_MASK;
+                                lh->strobe.Bytes_total -= lasso_hostStrobeBytes(dC);
+                                LASSO_CELL_DEACTIVATE(dC);
                             }
                         }
+
+                    #if (LASSO_HOST_STROBE_COPY_PLAN == 1)
+                        lasso_hostBuildCopyPlan(lh);
+                    #elif (LASSO_HOST_STROBE_SCATTER_GATHER == 1)
+                        lasso_hostBuildSegments(lh);
+                    #elif (LASSO_HOST_STROBE_DYNAMICS == LASSO_STROBE_DELTA)
+                        lh->strobeKeyframeCountdown = 0;    // resync client with keyframe
+                    #elif (LASSO_HOST_STROBE_MSGPACK == 1)
+                        lasso_hostBuildPackFrame(lh);
+                    #endif
+                    #if (LASSO_HOST_STROBE_COMPRESS == 1)
+                        lh->strobeKeyframeCountdown = 0;    // new payload layout, keyframe
+                    #endif
+                    #if (LASSO_HOST_DATACELL_INDEX == 1)
+                        lasso_hostBuildBytepos(lh);
+                    #endif
                     }
                     else {
                         msg_err = EFAULT;
                         break;
                     }
 
-                    if (lasso_advertise) {
+                    if (lh->lasso_advertise) {
                         return false;
                     }
 
                     break;
                 }
 
+            #if (LASSO_HOST_DATACELL_INDEX == 1)
+                case LASSO_HOST_SET_DATACELL_VALUE_HASH :
+            #endif
                 case LASSO_HOST_SET_DATACELL_VALUE : {
                     // advertising on: no reply is sent
                     // strobing on : tiny reply sent only for encodings COBS and ESCS
                     // strobing off: tiny reply sent (acknowledgement)
 
+                #if (LASSO_HOST_DATACELL_INDEX == 1)
+                    if (opcode == LASSO_HOST_SET_DATACELL_VALUE_HASH) {
+                    #if (LASSO_HOST_PROCESSING_MODE == LASSO_MSGPACK_MODE)
+                        msg_err = PackReaderGetUnsignedInteger(&frame_reader, &lparam);
+                        if (msg_err == 0) {
+                            msg_err = lasso_hostFindDatacell(lh, lparam, &cparam);
+                        }
+                    #else
+                        msg_err = lasso_hostGetDatacellHash(lh, &receiverBuffer, &cparam);
+                    #endif
+                    }
+                    else
+                #endif
+                    {
                 #if (LASSO_HOST_PROCESSING_MODE == LASSO_MSGPACK_MODE)
-                    msg_err = PackReaderGetUnsignedInteger(&frame_reader, &lparam);
-                    cparam = (uint8_t)lparam;
+                        msg_err = PackReaderGetUnsignedInteger(&frame_reader, &lparam);
+                        cparam = (uint8_t)lparam;
                 #else
-                    msg_err = lasso_hostGetDatacellNumber(&receiverBuffer, &cparam);
+                        msg_err = lasso_hostGetDatacellNumber(&receiverBuffer, &cparam);
                 #endif
+                    }
                     if (msg_err) break;
-                    dC = lasso_hostSeekDatacell(cparam, &lparam);
+                    dC = lasso_hostSeekDatacell(lh, cparam, &lparam);
 
                     if (dC) {
                         if (dC->ctrl & LASSO_DATACELL_WRITEABLE) {
@@ -1823,12 +3897,12 @@ static bool lasso_hostInterpreteCommand (
                         msg_err = EFAULT;
                     }
 
-                    if (lasso_advertise) {
+                    if (lh->lasso_advertise) {
                         return false;
                     }
 
                 #if (LASSO_HOST_STROBE_ENCODING < LASSO_ENCODING_COBS)  // no response & strobe interleaving possible
-                    if (lasso_strobing) {
+                    if (lh->lasso_strobing) {
                         return false;
                     }
                 #endif
@@ -1852,41 +3926,45 @@ static bool lasso_hostInterpreteCommand (
         PackWriterPutSignedInteger(&frame_writer, msg_err);
     }
 
-    response.Bytes_total = PackWriterGetOffset(&frame_writer);
+    lh->response.Bytes_total = PackWriterGetOffset(&frame_writer);
 #else
     if (tiny_reply) {
         // tiny reply can be the consequence of an error
         // -> return to offset right behind opcode
-        responseBuffer = response.buffer;
+        responseBuffer = lh->response.buffer;
         responseBuffer++;
 
     // correct responseBuffer pointer for COBS
     #if (LASSO_HOST_COMMAND_ENCODING == LASSO_ENCODING_COBS)
-        responseBuffer += 2;   // access space behind COBS header
+        responseBuffer += LASSO_COBS_OFFSET(lh->response); // access space behind COBS header
     #endif
 
     // correct responseBuffer pointer for ESCS
     #if (LASSO_HOST_COMMAND_ENCODING == LASSO_ENCODING_ESCS)
-        responseBuffer += response.Bytes_max;   // access 2nd half of buffer
+        responseBuffer += LASSO_ESCS_OFFSET(lh->response);  // access 2nd half of buffer
     #endif
     }
 
     // print error code (0 for no error)
     #if (LASSO_HOST_PROCESSING_MODE == LASSO_ASCII_MODE)
+    #if (LASSO_HOST_ASCII_BUILTIN == 1)
+        msg_err = ASCII_print_int32((char*)responseBuffer, msg_err, 0);
+    #else
         msg_err = sprintf((char*)responseBuffer, "%li", (signed long)msg_err);
+    #endif
         responseBuffer += msg_err;
     #else
         *responseBuffer++ = (uint8_t)msg_err;
     #endif
 
     // compute transmission length (to be corrected further down for COBS and ESCS)
-    response.Bytes_total = responseBuffer - response.buffer;
+    lh->response.Bytes_total = responseBuffer - lh->response.buffer;
 #endif
 
 #if (LASSO_HOST_COMMAND_ENCODING == LASSO_ENCODING_RN)
     *responseBuffer++ = 0x0D;   // '\r'
     *responseBuffer   = 0x0A;   // '\n'
-    response.Bytes_total += 2;
+    lh->response.Bytes_total += 2;
 
     // no CRC generation allowed
 #else
@@ -1895,19 +3973,19 @@ static bool lasso_hostInterpreteCommand (
 
 // correct transmission length for COBS
 #if (LASSO_HOST_COMMAND_ENCODING == LASSO_ENCODING_COBS)
-    response.Bytes_total -= 2;  // COBS header does not count as payload Bytes
+    lh->response.Bytes_total -= LASSO_COBS_OFFSET(lh->response);   // COBS header does not count as payload Bytes
 #endif
 
 // correct transmission length for ESCS
 #if (LASSO_HOST_COMMAND_ENCODING == LASSO_ENCODING_ESCS)
-    response.Bytes_total -= response.Bytes_max;   // correct initial offset
+    lh->response.Bytes_total -= LASSO_ESCS_OFFSET(lh->response);  // correct initial offset
 #endif
 
 #endif
 
 #if (LASSO_HOST_COMMAND_CRC_ENABLE == 1)
-    lasso_hostAppendCRC(crcBuffer, response.Bytes_total);
-    response.Bytes_total += LASSO_HOST_CRC_BYTEWIDTH;
+    lasso_hostAppendCRC(lh, crcBuffer, lh->response.Bytes_total);
+    lh->response.Bytes_total += LASSO_HOST_CRC_BYTEWIDTH;
 #endif
 
 #endif
@@ -1916,6 +3994,65 @@ static bool lasso_hostInterpreteCommand (
 }
 
 
+/*!
+ *  \brief  Send a data frame through the ESCS staging window.
+ *
+ *          The frame's payload is ESCS encoded in parts of up to
+ *          LASSO_HOST_ESCS_WINDOW_SIZE Bytes into one half of the staging
+ *          window, while the other half may still be in transmission:
+ *          - encode first part when a new frame is started
+ *          - transmit encoded half, if serial link not busy
+ *          - then encode next part into the other half right away
+ *          - frame owns the window until its end delimiter has been sent
+ *
+ *          The frame's Byte count drops to 0 once all payload is encoded, so
+ *          its buffer may be released (see lasso_hostSignalFinishedCOM())
+ *          while the tail of the frame is still held in the window.
+ *
+ *  \return TRUE if sending window, FALSE if serial port or window busy
+ */
+#if (LASSO_HOST_ESCS_WINDOW_SIZE > 0)
+static bool lasso_hostTransmitESCS (
+    lasso_host_t* lh,                       //!< Lasso host instance
+    dataFrame* ptr                          //!< data frame pointer
+) {
+    if (lh->escsOwner != ptr) {
+        if (lh->escsOwner) {
+            return false;                   // window busy with other frame
+        }
+        lh->escsOwner = ptr;
+        lh->escsPending = ESCS_encode_part(&ptr->frame, &ptr->Byte_count,
+            lh->escsWindow + lh->escsHalf * LASSO_HOST_ESCS_WINDOW_SIZE,
+            LASSO_HOST_ESCS_WINDOW_SIZE, true);
+        lh->escsLast = (ptr->Byte_count == 0);
+    }
+
+    // for errors other than EBUSY, no attempt to retransmit is made!
+    if (lh->comCallback(lh->escsWindow + lh->escsHalf * LASSO_HOST_ESCS_WINDOW_SIZE, lh->escsPending) != EBUSY) {
+        LASSO_PERF_SENT(ptr, lh->escsPending);
+        lh->lastFrame = ptr;                    // for permission re-enable in callback func
+        lh->escsHalf ^= 1;
+
+        if (lh->escsLast) {
+            lh->escsOwner = NULL;               // end delimiter sent, release window
+            lh->escsPending = 0;
+        }
+        else {
+            // other half is idle now, encode next part ahead of time
+            lh->escsPending = ESCS_encode_part(&ptr->frame, &ptr->Byte_count,
+                lh->escsWindow + lh->escsHalf * LASSO_HOST_ESCS_WINDOW_SIZE,
+                LASSO_HOST_ESCS_WINDOW_SIZE, false);
+            lh->escsLast = (ptr->Byte_count == 0);
+        }
+        return true;
+    }
+
+    LASSO_PERF_INC(LASSO_PERF_BUSY_RETRIES);
+    return false;
+}
+#endif
+
+
 /*!
  *  \brief  Send a strobe or response data frame.
  *
@@ -1928,29 +4065,68 @@ static bool lasso_hostInterpreteCommand (
  *          - send with 3 Bytes overhead on serial link
  *          - if serial link busy, transmission is delayed to next lasso cycle
  *
+ *          For COBS encoding with LASSO_HOST_COBS_CHUNKED_FRAMES == 0:
+ *          - entire frame is COBS encoded in place (once)
+ *          - encoded frame is sent as below
+ *
+ *          For ESCS encoding with LASSO_HOST_ESCS_WINDOW_SIZE > 0:
+ *          - see lasso_hostTransmitESCS()
+ *
  *          For other encodings:
  *          - data frame is cut into chunks of "LASSO_HOST_MAX_FRAME_SIZE" size
  *          - if serial link busy, transmission is delayed to next lasso cycle
  *
+ *          For scatter-gather strobes:
+ *          - segment list is handed to user in one go (no frame size limit)
+ *          - if serial link busy, transmission is delayed to next lasso cycle
+ *
  *  \return TRUE if sending frame, FALSE if serial port busy or nothing to send
  */
 static bool lasso_hostTransmitDataFrame (
+    lasso_host_t* lh,                       //!< Lasso host instance
     dataFrame* ptr                          //!< data frame pointer
 ) {
     uint8_t* frame = ptr->frame;
     uint32_t num = ptr->Byte_count;
-    #if (LASSO_HOST_COMMAND_ENCODING == LASSO_ENCODING_COBS)
+    #if (LASSO_HOST_COMMAND_ENCODING == LASSO_ENCODING_COBS) && \
+        (LASSO_HOST_COBS_CHUNKED_FRAMES == 1)
         bool extended = false;
     #endif
 
     if (num > 0) {
+
+    #if (LASSO_HOST_STROBE_SCATTER_GATHER == 1)
+        // strobes are sent in one go, straight from underlying memory cells
+        if ((ptr == &lh->strobe) && (!lh->lasso_advertise)) {
+            // for errors other than EBUSY, no attempt to retransmit is made!
+            if (lh->sgCallback(lh->strobeSegments, lh->strobeSegmentCount) != EBUSY) {
+                LASSO_PERF_SENT(ptr, ptr->Byte_count);
+                ptr->Byte_count = 0;
+                lh->lastFrame       = ptr;  // for permission re-enable in callback func
+                return true;
+            }
+
+            LASSO_PERF_INC(LASSO_PERF_BUSY_RETRIES);
+            return false;
+        }
+    #endif
         
     #if (LASSO_HOST_COMMAND_ENCODING == LASSO_ENCODING_COBS)
     #if (LASSO_HOST_COMMAND_ENCODING != LASSO_HOST_STROBE_ENCODING)
-        if (ptr != &strobe) {
+        if (ptr != &lh->strobe) {
     #else
-        if (!lasso_advertise) {
+        if (!lh->lasso_advertise) {
     #endif
+        #if (LASSO_HOST_COBS_CHUNKED_FRAMES == 0)
+            // COBS encode entire frame in place if not already done (COBS_backup
+            // serves as "encoded" flag), then send in parts of max. frame size
+            if (!ptr->COBS_backup) {
+                ptr->Byte_count  = COBS_encode_frame(frame, frame + ptr->COBS_offset, num);
+                ptr->COBS_backup = 1;
+                num = ptr->Byte_count;          // encoding changes length of frame !
+            }
+        }
+        #else
             //if (ptr == &strobe) {
             //    extended = false;
             //}
@@ -1969,101 +4145,436 @@ static bool lasso_hostTransmitDataFrame (
             if (frame[0] != 0x00) {                             // 0x00 is COBS delimiter
                 // restore and save operations for Byte crushed by COBS_encode()
                 frame[2] = ptr->COBS_backup;                    // restore 3rd Byte
-                ptr->COBS_backup = frame[255];                  // save 256th = next 3rd Byte
+                if (extended) {
+                    ptr->COBS_backup = frame[255];              // save 256th = next 3rd Byte
+                }
                 COBS_encode((COBS_buf*)frame, num, extended);   // encode up to 253 payload Bytes
             }
 
             // for errors other than EBUSY, no attempt to retransmit is made!
-            if (comCallback(frame, num + 3) != EBUSY) { // "num" must not include COBS header nor trailing COBS delimiter
+            if (lh->comCallback(frame, num + 3) != EBUSY) { // "num" must not include COBS header nor trailing COBS delimiter
+                LASSO_PERF_SENT(ptr, num + 3);
                 ptr->frame      += num;
                 ptr->Byte_count -= num;
+                lh->lastFrame        = ptr; // for permission re-enable in callback func
                 return true;
             }
 
+            LASSO_PERF_INC(LASSO_PERF_BUSY_RETRIES);
             return false;
         }
+        #endif
     #endif
 
     #if (LASSO_HOST_COMMAND_ENCODING == LASSO_ENCODING_ESCS)
     #if (LASSO_HOST_COMMAND_ENCODING != LASSO_HOST_STROBE_ENCODING)
-        if (ptr != &strobe) {
+        if (ptr != &lh->strobe) {
     #else      
-        if (!lasso_advertise) {
+        if (!lh->lasso_advertise) {
     #endif
+        #if (LASSO_HOST_ESCS_WINDOW_SIZE > 0)
+            return lasso_hostTransmitESCS(lh, ptr);
+        #else
             // ESCS encode if not already done (=COM busy in previous cycle)
             if (frame[0] != 0x7E) {             // 0x7E is ESCS delimiter
                 ptr->Byte_count = ESCS_encode(ptr->frame + ptr->Bytes_max, frame, num);
                 num = ptr->Byte_count;          // encoding changes length of frame !
             }
+        #endif
         }
     #endif
 
-        // all other cases (RN encoded responses, un-encoded strobes) covered here:
+        // all other cases (RN encoded responses, un-encoded strobes, ESCS and
+        // whole-frame COBS encoded frames) covered here:
         if (num > LASSO_HOST_MAX_FRAME_SIZE) {
             num = LASSO_HOST_MAX_FRAME_SIZE;
         }
 
         // for errors other than EBUSY, no attempt to retransmit is made!
-        if (comCallback(frame, num) != EBUSY) {
+        if (lh->comCallback(frame, num) != EBUSY) {
+            LASSO_PERF_SENT(ptr, num);
             ptr->frame      += num;
             ptr->Byte_count -= num; 
-            lastFrame        = ptr; // for permission re-enable in callback func
+            lh->lastFrame        = ptr; // for permission re-enable in callback func
         
             // ----------------------
             // A shortcoming of Lasso
             // ----------------------
-            // The full bandwidth of the serial line cannot be used so far.
-            // Lasso host uses a single buffer to store strobe and notification
-            // frames. While transmitting on the serial line, write access to
-            // strobe and notification buffers is disabled.
+            // By default, Lasso host uses a single buffer to store strobe and
+            // notification frames. While transmitting on the serial line,
+            // write access to strobe and notification buffers is disabled.
             // Therefore, Lasso host needs a small window in between two trans-
             // missions to update each buffer if required.
             // A callback function is provided that must be called from user
             // code in order to re-enable write access to each buffer.
-            // A future update of Lasso host may eliminate the bandwidth issue
-            // by implementing a double-buffer strategy for each message type.
-            // However, this obviously comes with the cost of higher heap usage
-            // and higher computation needs from the CPU.
+            // For strobe frames, the bandwidth issue is eliminated with
+            // LASSO_HOST_STROBE_BUFFERS > 1: the next strobe is sampled into
+            // an idle buffer of the strobe ring while the current one is being
+            // transmitted, at the cost of one more strobe buffer on the heap.
             
             return true;
         }
+
+        LASSO_PERF_INC(LASSO_PERF_BUSY_RETRIES);
     }
 
     return false;
 }
 
+/*!
+ *  \brief  Share the serial link among strobe, response and notification.
+ *
+ *          Stride scheduling at frame boundaries:
+ *          - each stream's pass grows by its Bytes sent, scaled by the
+ *            inverse of its link share (LASSO_HOST_LINK_SHARE_xxx)
+ *          - the pending stream with the lowest pass is started next, so
+ *            each backlogged stream obtains at least its share of the link
+ *            and shares of idle streams go to the others
+ *          - a stream entering the backlog starts at the pass of the stream
+ *            served last (no credit is saved up while idle)
+ *          - a response or notification pending for more than
+ *            LASSO_HOST_LINK_LATENCY_TICKS is started next regardless
+ *
+ *          Frames are never interleaved on the serial line: a frame once
+ *          started holds the link until it has been sent completely.
+ *
+ *  \return Void
+ */
+#if (LASSO_HOST_LINK_SCHEDULER == LASSO_LINK_WEIGHTED)
+static void lasso_hostScheduleLink (
+    lasso_host_t* lh            //!< Lasso host instance
+) {
+    static const uint16_t stride[LASSO_LINK_STREAMS] = {
+        LASSO_LINK_STRIDE(LASSO_LINK_SHARE_STROBE),
+    #if (LASSO_HOST_NOTIFICATIONS == 1)
+        LASSO_LINK_STRIDE(LASSO_HOST_LINK_SHARE_RESPONSE),
+        LASSO_LINK_STRIDE(LASSO_HOST_LINK_SHARE_NOTIFICATION)
+    #else
+        LASSO_LINK_STRIDE(LASSO_HOST_LINK_SHARE_RESPONSE)
+    #endif
+    };
+    dataFrame* frames[LASSO_LINK_STREAMS];
+    dataFrame* ptr;
+    uint8_t* frame;
+    uint32_t num;
+    uint8_t next = LASSO_LINK_STREAMS;
+    uint8_t i;
+
+    frames[0] = &lh->strobe;
+    frames[1] = &lh->response;
+    #if (LASSO_HOST_NOTIFICATIONS == 1)
+    frames[2] = &lh->notification;
+    #endif
+
+    // track backlog of each stream
+    for (i = 0; i < LASSO_LINK_STREAMS; i++) {
+        if (frames[i]->Byte_count == 0) {
+            lh->linkWait[i] = 0;
+        }
+        else {
+            if (lh->linkWait[i] == 0) {     // entering backlog
+                if ((int32_t)(lh->linkPass[i] - lh->linkClock) < 0) {
+                    lh->linkPass[i] = lh->linkClock;
+                }
+            }
+            if (lh->linkWait[i] < UINT16_MAX) {
+                lh->linkWait[i]++;
+            }
+        }
+    }
+
+    #if (LASSO_HOST_ESCS_WINDOW_SIZE > 0)
+    if (lh->escsOwner) {
+        lh->linkOwner = lh->escsOwner;      // frame tail still in window
+    }
+    #endif
+
+    // a started frame holds the link
+    for (i = 0; i < LASSO_LINK_STREAMS; i++) {
+        if (frames[i] == lh->linkOwner) {
+            next = i;
+        }
+    }
+
+    if (next == LASSO_LINK_STREAMS) {
+        // latency budget exceeded: response first, then notification
+        for (i = LASSO_LINK_STREAMS - 1; i > 0; i--) {
+            if (lh->linkWait[i] > LASSO_HOST_LINK_LATENCY_TICKS) {
+                next = i;
+            }
+        }
+    }
+
+    if (next == LASSO_LINK_STREAMS) {
+        // lowest pass among pending streams
+        for (i = 0; i < LASSO_LINK_STREAMS; i++) {
+            if (lh->linkWait[i] && ((next == LASSO_LINK_STREAMS) ||
+                ((int32_t)(lh->linkPass[i] - lh->linkPass[next]) < 0))) {
+                next = i;
+            }
+        }
+
+        if (next == LASSO_LINK_STREAMS) {
+            return;                         // nothing to send
+        }
+    }
+
+    ptr   = frames[next];
+    frame = ptr->frame;
+    num   = ptr->Byte_count;
+
+    #if (LASSO_HOST_ESCS_WINDOW_SIZE > 0)
+    if (lh->escsOwner == ptr ? lasso_hostTransmitESCS(lh, ptr) : lasso_hostTransmitDataFrame(lh, ptr)) {
+    #else
+    if (lasso_hostTransmitDataFrame(lh, ptr)) {
+    #endif
+        // Bytes sent (scatter-gather strobes do not advance frame pointer)
+        num = (ptr->frame != frame) ? (uint32_t)(ptr->frame - frame) : num;
+
+        lh->linkClock = lh->linkPass[next];
+        lh->linkPass[next] += num * stride[next];
+
+        if (ptr->Byte_count > 0) {
+            lh->linkOwner = ptr;
+        }
+        else {
+            lh->linkOwner = NULL;
+            lh->linkWait[next] = 0;         // frame done, next one waits anew
+        }
+    #if (LASSO_HOST_ESCS_WINDOW_SIZE > 0)
+        if (lh->escsOwner) {
+            lh->linkOwner = lh->escsOwner;
+        }
+    #endif
+    }
+}
+#endif
+
+
+
+/*!
+ *  \brief  Release transmitted strobe ring buffer and load next one.
+ *
+ *          The strobe frame's permission flag is re-enabled by
+ *          lasso_hostSignalFinishedCOM() when the tail buffer has been
+ *          transmitted completely. The tail buffer is then returned to the
+ *          ring and the next queued buffer (if any) is loaded for transmission.
+ *
+ *  \return Void
+ */
+#if (LASSO_HOST_STROBE_BUFFERS > 1)
+static void lasso_hostLoadStrobeRing (
+    lasso_host_t* lh            //!< Lasso host instance
+) {
+    if (!lh->strobe.permission) {
+        return;     // tail buffer (or signature) still being transmitted
+    }
+
+    if (lh->strobeRingBusy) {
+        lh->strobeRingBusy = false;
+        if (++lh->strobeRingTail == LASSO_HOST_STROBE_BUFFERS) {
+            lh->strobeRingTail = 0;
+        }
+    }
+
+    if ((lh->strobeRingQueued > 0) && (!lh->lasso_advertise)) {
+        lh->strobe.frame = lh->strobeRing[lh->strobeRingTail];          // load buffer start
+        lh->strobe.Byte_count = lh->strobeRingBytes[lh->strobeRingTail];// trigger transmission
+    #if (LASSO_HOST_AUTOTUNE == 1)
+        lh->autotuneStart = lh->autotuneClock;
+    #endif
+
+    #if (LASSO_HOST_STROBE_ENCODING == LASSO_ENCODING_COBS)
+        LASSO_COBS_PREPARE(lh->strobe);             // see LASSO_COBS_PREPARE()
+    #endif
+
+        lh->strobeRingQueued--;
+        lh->strobeRingBusy = true;
+        lh->strobe.permission = false;              // lock tail buffer
+    }
+}
+#endif
+
 
 /*!
  *  \brief  Registers the host's internal timestamp.
  *
  *  \return Error code
  */
-#if (LASSO_HOST_TIMESTAMP == 1)
-static int32_t lasso_hostRegisterTimestamp (void) {
-    return lasso_hostRegisterDataCell(LASSO_UINT32,
-                                      1,
-                                      (void*)&lasso_timestamp,
-                                      "Timestamp",
-                                      TOSTR(LASSO_HOST_TICK_PERIOD_MS) "ms",
-#if (LASSO_HOST_STROBE_DYNAMICS != LASSO_STROBE_DYNAMIC)
-                                      NULL);
+#if (LASSO_HOST_TIMESTAMP == 1)
+static int32_t lasso_hostRegisterTimestamp (
+    lasso_host_t* lh            //!< Lasso host instance
+) {
+    return lasso_hostRegisterDataCell_r(lh, LASSO_TIMESTAMP_TYPE,
+                                      1,
+                                      (void*)&lh->lasso_timestamp,
+                                      "Timestamp",
+#if (LASSO_HOST_TIMESTAMP_TIMER == 1)
+                                      LASSO_HOST_TIMESTAMP_UNIT,
+#else
+                                      TOSTR(LASSO_HOST_TICK_PERIOD_MS) "ms",
+#endif
+#if (LASSO_HOST_STROBE_DYNAMICS == LASSO_STROBE_STATIC)
+                                      NULL);
+#else
+                                      NULL,
+                                      1);
+#endif
+}
+#endif
+
+
+/*!
+ *  \brief  Registers the host's performance counters (read-only array).
+ *
+ *          Not a default strobe member, element order see LASSO_PERF_xxx.
+ *
+ *  \return Error code
+ */
+#if (LASSO_HOST_PERF_COUNTERS == 1)
+static int32_t lasso_hostRegisterPerf (
+    lasso_host_t* lh            //!< Lasso host instance
+) {
+    return lasso_hostRegisterDataCell_r(lh, LASSO_UINT32 | LASSO_DATACELL_NOSTROBE,
+                                      LASSO_PERF_COUNTERS,
+                                      (void*)lh->perf,
+                                      "Perf",
+                                      "",
+#if (LASSO_HOST_STROBE_DYNAMICS == LASSO_STROBE_STATIC)
+                                      NULL);
+#else
+                                      NULL,
+                                      1);
+#endif
+}
+#endif
+
+
+/*!
+ *  \brief  Clear receive timeout and buffer index.
+ *
+ *  \return Void
+ */
+void lasso_clearReceiveTimeout (
+    lasso_host_t* lh            //!< Lasso host instance
+) {
+    lh->receiveBufferIndex = 0;
+    lh->receiveTimeout = 0;
+}
+
+
+/*!
+ *  \brief  Trigger transmission of response frame.
+ *
+ *  \return Void
+ */
+static void lasso_hostLoadResponse (
+    lasso_host_t* lh            //!< Lasso host instance
+) {
+    lh->response.frame = lh->response.buffer;           // load buffer start
+    lh->response.Byte_count = lh->response.Bytes_total; // trigger transmission
+
+#if (LASSO_HOST_COMMAND_ENCODING == LASSO_ENCODING_COBS)
+    LASSO_COBS_PREPARE(lh->response);
+#endif
+
+    lh->response.permission = false;                // lock response frame buffer
+}
+
+
+/*!
+ *  \brief  Queue completely received command and continue reception in the
+ *          next free command buffer.
+ *
+ *          If the queue is full, receiveValid remains set and further Bytes
+ *          are rejected until lasso_hostReleaseCommand() frees a buffer.
+ *
+ *  \return Void
+ */
+#if (LASSO_HOST_COMMAND_QUEUE > 1)
+static void lasso_hostQueueCommand (
+    lasso_host_t* lh            //!< Lasso host instance
+) {
+    lh->commandQueueValid[lh->commandQueueIn & (LASSO_HOST_COMMAND_QUEUE - 1)] = lh->receiveValid;
+    lh->commandQueueIn++;
+
+    if ((uint8_t)(lh->commandQueueIn - lh->commandQueueOut) < LASSO_HOST_COMMAND_QUEUE) {
+        lh->receiveBuffer = lh->commandQueue[lh->commandQueueIn & (LASSO_HOST_COMMAND_QUEUE - 1)];
+        lh->receiveValid = 0;
+    }
+}
+#endif
+
+
+/*!
+ *  \brief  Select oldest received command for interpretation.
+ *
+ *  \return True if a command is available in commandBuffer
+ */
+static bool lasso_hostPeekCommand (
+    lasso_host_t* lh            //!< Lasso host instance
+) {
+#if (LASSO_HOST_COMMAND_QUEUE > 1)
+    if (lh->commandQueueIn == lh->commandQueueOut) {
+        return false;
+    }
+    lh->commandBuffer = lh->commandQueue[lh->commandQueueOut & (LASSO_HOST_COMMAND_QUEUE - 1)];
+    lh->commandValid = lh->commandQueueValid[lh->commandQueueOut & (LASSO_HOST_COMMAND_QUEUE - 1)];
+#else
+    if (lh->receiveValid == 0) {
+        return false;
+    }
+    lh->commandBuffer = lh->receiveBuffer;
+    lh->commandValid = lh->receiveValid;
+#endif
+
+    return true;
+}
+
+
+/*!
+ *  \brief  Release command buffer after interpretation.
+ *
+ *  \return Void
+ */
+static void lasso_hostReleaseCommand (
+    lasso_host_t* lh            //!< Lasso host instance
+) {
+#if (LASSO_HOST_COMMAND_QUEUE > 1)
+    lh->commandQueueOut++;
+
+    // receiver blocked by full queue? -> hand over the buffer just freed
+    if (lh->receiveValid > 0) {
+        lh->receiveBuffer = lh->commandQueue[lh->commandQueueIn & (LASSO_HOST_COMMAND_QUEUE - 1)];
+        lh->receiveValid = 0;
+    }
 #else
-                                      NULL,
-                                      1);
+    lh->receiveValid = 0;
 #endif
 }
-#endif
 
 
 /*!
- *  \brief  Clear receive timeout and buffer index.
+ *  \brief  Synthesize next sub-command of a batch into commandBuffer.
  *
  *  \return Void
  */
-void lasso_clearReceiveTimeout(void) {
-    receiveBufferIndex = 0;
-    receiveTimeout = 0;
+#if (LASSO_HOST_COMMAND_BATCH == 1)
+static void lasso_hostNextBatchCommand (
+    lasso_host_t* lh            //!< Lasso host instance
+) {
+    #if (LASSO_HOST_ASCII_BUILTIN == 1)
+    lh->batchCommand[0] = lh->batchOpcode;
+    lh->commandValid = (uint8_t)(1 + ASCII_print_uint32((char*)lh->batchCommand + 1, lh->batchNext, 0));
+    #else
+    lh->commandValid = (uint8_t)sprintf((char*)lh->batchCommand, "%c%u", lh->batchOpcode, (unsigned int)lh->batchNext);
+    #endif
+    lh->commandBuffer = lh->batchCommand;
+
+    lh->batchNext++;
+    lh->batchRemaining--;
 }
+#endif
 
 
 //----------------------//
@@ -2071,13 +4582,19 @@ void lasso_clearReceiveTimeout(void) {
 //----------------------//
 
 /*!
- *  \brief  Register user-supplied communication functions.
+ *  \brief  Register transmit backend of a target.
+ *
+ *          The backend's setup operation is run once, its start operation
+ *          is called for each frame. If it supplies an idle operation, no
+ *          transmission complete interrupt is needed: lasso_hostHandleCOM()
+ *          polls the transmitter and releases the frame buffers itself.
+ *          A scatter-gather operation replaces lasso_hostRegisterSG().
  *
  *  \return Error code
  */
-int32_t lasso_hostRegisterCOM (
-    lasso_comSetup cS,          //!< user-supplied function to setup serial COM
-    lasso_comCallback cC,       //!< user-supplied callback on COM transmission
+LASSO_API_R int32_t lasso_hostRegisterTX_r (
+    lasso_host_t* lh,           //!< Lasso host instance
+    const lasso_txBackend* tx,  //!< transmit backend of target
     lasso_actCallback aC,       //!< user-supplied callback on strobe activation
 #if (LASSO_HOST_STROBE_CRC_ENABLE == 1) || (LASSO_HOST_COMMAND_CRC_ENABLE == 1)
     lasso_perCallback pC,       //!< user-supplied callback on period change
@@ -2088,59 +4605,98 @@ int32_t lasso_hostRegisterCOM (
 ) {
     int32_t res;
 
-    if (cS) {
-        res = cS();
-
-        if (res) {
-            return res;
-        }
-    }
-    else {
+    if ((tx == NULL) || (tx->setup == NULL) || (tx->start == NULL)) {
         return EINVAL;
     }
 
-    if (cC) {
-        comCallback = cC;
+    res = tx->setup();
+
+    if (res) {
+        return res;
     }
-    else {
-        return EINVAL;
+
+    lh->comCallback = tx->start;
+    lh->txIdle      = tx->idle;
+
+#if (LASSO_HOST_STROBE_SCATTER_GATHER == 1)
+    if (tx->sg) {
+        lh->sgCallback = tx->sg;
     }
+#endif
 
     if (aC) {
-        actCallback = aC;
+        lh->actCallback = aC;
     }
 
     if (pC) {
-        perCallback = pC;
+        lh->perCallback = pC;
     }
 
 #if (LASSO_HOST_TIMESTAMP == 1)
-    lasso_hostRegisterTimestamp();
+    lasso_hostRegisterTimestamp(lh);
+#endif
+
+#if (LASSO_HOST_PERF_COUNTERS == 1)
+    lasso_hostRegisterPerf(lh);
 #endif
 
 #if (LASSO_HOST_STROBE_CRC_ENABLE == 1) || (LASSO_HOST_COMMAND_CRC_ENABLE == 1)
+    // built-in CRC engine does not need a user-supplied CRC generator
     if (rC) {
-        crcCallback = rC;
+        lh->crcCallback = rC;
     }
+#if (LASSO_HOST_CRC_ENGINE == LASSO_CRC_USER)
     else {
         return EINVAL;
     }
+#endif
 #endif
 
     return 0;
 }
 
 
+/*!
+ *  \brief  Register user-supplied communication functions.
+ *
+ *          Transmission complete must be signaled by user code, see
+ *          lasso_hostSignalFinishedCOM().
+ *
+ *  \return Error code
+ */
+LASSO_API_R int32_t lasso_hostRegisterCOM_r (
+    lasso_host_t* lh,           //!< Lasso host instance
+    lasso_comSetup cS,          //!< user-supplied function to setup serial COM
+    lasso_comCallback cC,       //!< user-supplied callback on COM transmission
+    lasso_actCallback aC,       //!< user-supplied callback on strobe activation
+#if (LASSO_HOST_STROBE_CRC_ENABLE == 1) || (LASSO_HOST_COMMAND_CRC_ENABLE == 1)
+    lasso_perCallback pC,       //!< user-supplied callback on period change
+    lasso_crcCallback rC        //!< user-supplied CRC generator
+#else
+    lasso_perCallback pC        //!< user-supplied callback on period change
+#endif
+) {
+    const lasso_txBackend tx = { cS, cC, NULL, NULL };
+
+#if (LASSO_HOST_STROBE_CRC_ENABLE == 1) || (LASSO_HOST_COMMAND_CRC_ENABLE == 1)
+    return lasso_hostRegisterTX_r(lh, &tx, aC, pC, rC);
+#else
+    return lasso_hostRegisterTX_r(lh, &tx, aC, pC);
+#endif
+}
+
+
 /*!
  *  \brief  Register user-supplied callback for command received event.
  *
  *  \return Error code
  */
-int32_t lasso_hostRegisterCMDRX (
+LASSO_API_R int32_t lasso_hostRegisterCMDRX_r (
+    lasso_host_t* lh,               //!< Lasso host instance
     lasso_cmdCallback cC            //!< user-supplied CMDRX function
 ) {
     if (cC) {
-        cmdCallback = cC;
+        lh->cmdCallback = cC;
     }
     else {
         return EINVAL;
@@ -2155,11 +4711,157 @@ int32_t lasso_hostRegisterCMDRX (
  *
  *  \return Error code
  */
-int32_t lasso_hostRegisterCTRLS (
+LASSO_API_R int32_t lasso_hostRegisterCTRLS_r (
+    lasso_host_t* lh,               //!< Lasso host instance
+    lasso_ctlCallback cC            //!< user-supplied CTRLS function
+) {
+    if (cC) {
+        lh->ctlCallback = cC;
+    }
+    else {
+        return EINVAL;
+    }
+
+    return 0;
+}
+
+
+/*!
+ *  \brief  Register user-supplied callback for controls received in the
+ *          receive path.
+ *
+ *          Called from lasso_hostReceiveByte() (usually interrupt context)
+ *          as soon as a controls frame is complete, with a pointer into the
+ *          receive buffer (valid during the call only). With a receive ring,
+ *          frames are decoded (and the callback is called) in lasso_host-
+ *          HandleCOM().
+ *
+ *  \return Error code
+ */
+#if (LASSO_HOST_CONTROLS_SIZE > 0)
+LASSO_API_R int32_t lasso_hostRegisterCTRLSISR_r (
+    lasso_host_t* lh,               //!< Lasso host instance
     lasso_ctlCallback cC            //!< user-supplied CTRLS function
 ) {
     if (cC) {
-        ctlCallback = cC;
+        lh->ctlIsrCallback = cC;
+    }
+    else {
+        return EINVAL;
+    }
+
+    return 0;
+}
+#endif
+
+
+/*!
+ *  \brief  Register user-supplied incremental CRC generator (e.g. CRC unit).
+ *
+ *          Replaces CRC generator of lasso_hostRegisterCOM() and built-in
+ *          CRC engine. Strobe CRC is then computed while sampling data cells.
+ *
+ *  \return Error code
+ */
+#if (LASSO_HOST_STROBE_CRC_ENABLE == 1) || (LASSO_HOST_COMMAND_CRC_ENABLE == 1)
+LASSO_API_R int32_t lasso_hostRegisterCRC_r (
+    lasso_host_t* lh,               //!< Lasso host instance
+    lasso_crcUpdateCallback uC      //!< user-supplied incremental CRC function
+) {
+    if (uC) {
+        lh->crcUpdateCallback = uC;
+    }
+    else {
+        return EINVAL;
+    }
+
+    return 0;
+}
+#endif
+
+
+/*!
+ *  \brief  Register user-supplied memory-to-memory copy function (e.g. DMA).
+ *
+ *  \return Error code
+ */
+#if (LASSO_HOST_MEMCPY_MIN_BYTES > 0)
+LASSO_API_R int32_t lasso_hostRegisterMEMCPY_r (
+    lasso_host_t* lh,               //!< Lasso host instance
+    lasso_memcpyCallback mC         //!< user-supplied MEMCPY function
+) {
+    if (mC) {
+        lh->memcpyCallback = mC;
+    }
+    else {
+        return EINVAL;
+    }
+
+    return 0;
+}
+#endif
+
+
+/*!
+ *  \brief  Register user-supplied hardware timer for the timestamp data cell.
+ *
+ *  \return Error code
+ */
+#if (LASSO_HOST_TIMESTAMP_TIMER == 1)
+LASSO_API_R int32_t lasso_hostRegisterTIMER_r (
+    lasso_host_t* lh,               //!< Lasso host instance
+    lasso_timerCallback tC          //!< user-supplied timer read function
+) {
+    if (tC) {
+        lh->timerCallback = tC;
+    }
+    else {
+        return EINVAL;
+    }
+
+#if (LASSO_HOST_TIMESTAMP_64BIT == 1)
+    lh->timerLast = tC();
+#endif
+
+    return 0;
+}
+#endif
+
+
+/*!
+ *  \brief  Register user-supplied scatter-gather strobe transmission function.
+ *
+ *  \return Error code
+ */
+#if (LASSO_HOST_STROBE_SCATTER_GATHER == 1)
+LASSO_API_R int32_t lasso_hostRegisterSG_r (
+    lasso_host_t* lh,               //!< Lasso host instance
+    lasso_sgCallback sC             //!< user-supplied SG function
+) {
+    if (sC) {
+        lh->sgCallback = sC;
+    }
+    else {
+        return EINVAL;
+    }
+
+    return 0;
+}
+#endif
+
+
+/*!
+ *  \brief  Register user-supplied capture trigger (oscilloscope mode).
+ *
+ *  \return Error code
+ */
+#if (LASSO_HOST_CAPTURE_SIZE > 0)
+LASSO_API_R int32_t lasso_hostRegisterTRIG_r (
+    lasso_host_t* lh,               //!< Lasso host instance
+    lasso_trgCallback tC            //!< user-supplied trigger function
+) {
+    if (tC) {
+        lh->trgCallback = tC;
     }
     else {
         return EINVAL;
@@ -2167,6 +4869,7 @@ int32_t lasso_hostRegisterCTRLS (
 
     return 0;
 }
+#endif
 
 
 /*!
@@ -2174,34 +4877,39 @@ int32_t lasso_hostRegisterCTRLS (
  *
  *  \return Error code
  */
-int32_t lasso_hostRegisterDataCell (
+#if (LASSO_HOST_DATASPACE_STATIC == 0)
+LASSO_API_R int32_t lasso_hostRegisterDataCell_r (
+    lasso_host_t* lh,                   //!< Lasso host instance
     uint16_t ctrl,                      //!< memory cell control/type
     uint16_t count,                     //!< array size
     const void* ptr,                    //!< pointer to memory cell
     const char* const name,             //!< identifier string
     const char* const unit,             //!< unit string
-#if (LASSO_HOST_STROBE_DYNAMICS != LASSO_STROBE_DYNAMIC)
+#if (LASSO_HOST_STROBE_DYNAMICS == LASSO_STROBE_STATIC)
     const lasso_chgCallback onChange    //!< user callback for change event
 #else
     const lasso_chgCallback onChange,   //!< user callback for change event
     uint16_t update_rate                //!< update rate info
 #endif
 ) {
-    dataCell* dC = (dataCell*)LASSO_HOST_MALLOC(sizeof(dataCell));
+    dataCell* dC = (dataCell*)lasso_hostAlloc(sizeof(dataCell));
     uint32_t dC_Bytes;
+#if (LASSO_HOST_STROBE_RATE_GROUPS == 1)
+    uint8_t k;
+#endif
 
     if (dC == NULL) {
         return ENOMEM;
     }
 
-    if (dataCellFirst == NULL) {
-        dataCellFirst = dC;
+    if (lh->dataCellFirst == NULL) {
+        lh->dataCellFirst = dC;
     }
 
-    if (dataCellLast != NULL) {
-        dataCellLast->next = dC;
+    if (lh->dataCellLast != NULL) {
+        lh->dataCellLast->next = dC;
     }
-    dataCellLast = dC;
+    lh->dataCellLast = dC;
 
     // invert bit that enables/disables datacell for default strobing
     ctrl ^= LASSO_DATACELL_NOSTROBE;
@@ -2224,12 +4932,30 @@ int32_t lasso_hostRegisterDataCell (
     dC->name        = name;
     dC->unit        = unit;
     dC->onChange    = onChange;
-#if (LASSO_HOST_STROBE_DYNAMICS == LASSO_STROBE_DYNAMIC)
+#if (LASSO_HOST_STROBE_DYNAMICS != LASSO_STROBE_STATIC)
     dC->update_rate = ((uint32_t)update_rate << 16) + update_rate;
 #else
     dC->update_rate = (1 << 16) + 1;
 #endif
     dC->next        = NULL;
+#if (LASSO_HOST_STROBE_DYNAMICS == LASSO_STROBE_DELTA)
+    dC->hash        = 0;
+#endif
+#if (LASSO_HOST_STROBE_RATE_GROUPS == 1)
+    // round update rate down to power of two: group k is due every 2^k strobes
+    for (k = 0; (k < LASSO_RATE_GROUPS - 1) && ((update_rate >> (k + 1)) != 0); k++);
+    dC->update_rate = ((uint32_t)1 << (k + 16)) + ((uint32_t)1 << k);
+    dC->index       = lh->dataCellCount;
+    dC->groupNext   = NULL;
+    if (lh->rateGroupLast[k] != NULL) {
+        lh->rateGroupLast[k]->groupNext = dC;
+    }
+    else {
+        lh->rateGroupFirst[k] = dC;
+    }
+    lh->rateGroupLast[k] = dC;
+    lh->rateGroupUsed |= (1 << k);
+#endif
 
     if (ctrl & LASSO_DATACELL_BYTEWIDTH_MASK) {
         dC_Bytes = (uint32_t)count * (uint32_t)(ctrl & LASSO_DATACELL_BYTEWIDTH_MASK);
@@ -2237,16 +4963,84 @@ int32_t lasso_hostRegisterDataCell (
     else {
         dC_Bytes = (uint32_t)count;
     }
-    strobe.Bytes_max += dC_Bytes;
+    lh->strobe.Bytes_max += dC_Bytes;
 
     if (ctrl & LASSO_DATACELL_ENABLE_MASK) {
-        strobe.Bytes_total += dC_Bytes;
+        lh->strobe.Bytes_total += dC_Bytes;
+    }
+
+    lh->dataCellCount++;
+
+    return 0;
+}
+#else
+/*!
+ *  \brief  Registers a const table of data cells as dataspace.
+ *
+ *          The table is not copied (it may reside in flash). Only strobe
+ *          membership and update rate countdowns are allocated (in RAM).
+ *
+ *  \return Error code
+ */
+LASSO_API_R int32_t lasso_hostRegisterDataspace_r (
+    lasso_host_t* lh,                   //!< Lasso host instance
+    const lasso_dataCell* table,        //!< data cells, see LASSO_DATACELL()
+    uint8_t count                       //!< number of data cells in table
+) {
+    dataCell* dC;
+    uint32_t dC_Bytes;
+    uint8_t num;
+
+    if (lh->dataCellFirst != NULL) {
+        return EBUSY;
+    }
+
+    if ((table == NULL) || (count == 0)) {
+        return EINVAL;
+    }
+
+    lh->dataCellActive = (uint8_t*)lasso_hostAlloc(((count - 1) >> 3) + 1);
+    if (lh->dataCellActive == NULL) {
+        return ENOMEM;
     }
+    memset(lh->dataCellActive, 0, ((count - 1) >> 3) + 1);
+
+#if (LASSO_HOST_STROBE_DYNAMICS != LASSO_STROBE_STATIC)
+    lh->dataCellCountdown = (uint16_t*)lasso_hostAlloc(count * sizeof(uint16_t));
+    if (lh->dataCellCountdown == NULL) {
+        return ENOMEM;
+    }
+#endif
 
-    dataCellCount++;
+    lh->dataCellFirst = table;
+    lh->dataCellLast  = table + count - 1;
+    lh->dataCellCount = count;
+
+    for (num = 0, dC = table; num < count; num++, dC++) {
+        if (dC->ptr == NULL) {
+            return EFAULT;
+        }
+#if (LASSO_HOST_STROBE_DYNAMICS != LASSO_STROBE_STATIC)
+        LASSO_CELL_RELOAD(dC);
+#endif
+
+        if (dC->ctrl & LASSO_DATACELL_BYTEWIDTH_MASK) {
+            dC_Bytes = (uint32_t)dC->count * (uint32_t)(dC->ctrl & LASSO_DATACELL_BYTEWIDTH_MASK);
+        }
+        else {
+            dC_Bytes = (uint32_t)dC->count;
+        }
+        lh->strobe.Bytes_max += dC_Bytes;
+
+        if (dC->ctrl & LASSO_DATACELL_ENABLE_MASK) {
+            LASSO_CELL_ACTIVATE(dC);
+            lh->strobe.Bytes_total += dC_Bytes;
+        }
+    }
 
     return 0;
 }
+#endif
 
 
 /*!
@@ -2279,43 +5073,75 @@ int32_t lasso_hostRegisterDataCell (
  *
  *          Finally, memory requirement is rounded to next alignment boundary.
  *
+ *          With LASSO_HOST_STROBE_ALIGN, the copy plan (or segment list) built
+ *          here lays out active data cells widest Byte width first, such that
+ *          each one is naturally aligned in the strobe payload. The permuta-
+ *          tion is published as Byte position in GET_DATACELL_PARAMS.
+ *          Strobe buffers then get up to LASSO_MEMORY_ALIGN - 1 lead Bytes,
+ *          such that the payload behind COBS/ESCS header and 0xC1 marker
+ *          starts on a LASSO_MEMORY_ALIGN boundary (aligned word stores).
+ *
  *  \return Error code
  */
-int32_t lasso_hostRegisterMEM (void) {
+LASSO_API_R int32_t lasso_hostRegisterMEM_r (
+    lasso_host_t* lh            //!< Lasso host instance
+) {
 
 // ----------- //
 // STROBE PART //
 // ----------- //
 
+// msgpack strobes: packed data cell sizes and array header
+#if (LASSO_HOST_STROBE_MSGPACK == 1)
+    lasso_hostBuildPackTemplates(lh);
+    lasso_hostBuildPackFrame(lh);
+#endif
+
+// compressed strobes: reference and byte plane buffers for all data cells,
+// header Byte and one code Byte per 128 literal Bytes (worst case)
+#if (LASSO_HOST_STROBE_COMPRESS == 1)
+    lh->compressRef = (uint8_t*)lasso_hostAlloc(lh->strobe.Bytes_max);
+    lh->compressTmp = (uint8_t*)lasso_hostAlloc(lh->strobe.Bytes_max);
+    if ((lh->compressRef == NULL) || (lh->compressTmp == NULL)) {
+        return ENOMEM;
+    }
+    lh->strobe.Bytes_max += 1 + (lh->strobe.Bytes_max + 127) / 128;
+#endif
+
 // in strobe ESCS or COBS encoding, an "invalid" MessagePack code is
 // inserted before strobe packet for interleaving with responses packet
 #if (LASSO_HOST_STROBE_ENCODING == LASSO_ENCODING_ESCS) || \
     (LASSO_HOST_STROBE_ENCODING == LASSO_ENCODING_COBS)
-    strobe.Bytes_max += 1;
-    strobe.Bytes_total += 1;
+    lh->strobe.Bytes_max += 1;
+    lh->strobe.Bytes_total += 1;
 #endif
 
 // add space for dynamic strobing information at the beginning of strobe packet
-#if (LASSO_HOST_STROBE_DYNAMICS == LASSO_STROBE_DYNAMIC)
-    dataCellMaskBytes = ((dataCellCount - 1) >> 3) + 1;
-    strobe.Bytes_max += dataCellMaskBytes;
-    strobe.Bytes_total += dataCellMaskBytes;
+#if (LASSO_HOST_STROBE_DYNAMICS != LASSO_STROBE_STATIC)
+    lh->dataCellMaskBytes = ((lh->dataCellCount - 1) >> 3) + 1;
+    lh->strobe.Bytes_max += lh->dataCellMaskBytes;
+    lh->strobe.Bytes_total += lh->dataCellMaskBytes;
 #endif
 
 // add space for CRC to end of strobe packet
 #if (LASSO_HOST_STROBE_CRC_ENABLE == 1)
-    strobe.Bytes_max += LASSO_HOST_CRC_BYTEWIDTH;
-    strobe.Bytes_total += LASSO_HOST_CRC_BYTEWIDTH;
+    lh->strobe.Bytes_max += LASSO_HOST_CRC_BYTEWIDTH;
+    lh->strobe.Bytes_total += LASSO_HOST_CRC_BYTEWIDTH;
 #endif
 
 // ESCS encoding requires substantial (worst case) overhead
 #if (LASSO_HOST_STROBE_ENCODING == LASSO_ENCODING_ESCS)
-    strobe.Bytes_max += 2;      // start and end delimiter
+    lh->strobe.Bytes_max += 2;      // start and end delimiter
     //strobe.Bytes_max *= 2;      // worst case (see further below)
 
 // COBS encoding always requires constant overhead
 #elif (LASSO_HOST_STROBE_ENCODING == LASSO_ENCODING_COBS)
-    strobe.Bytes_max += 3;      // start/end delimiter + COBS code
+#if (LASSO_HOST_COBS_CHUNKED_FRAMES == 0)
+    lh->strobe.COBS_offset = COBS_HEADER_SIZE(lh->strobe.Bytes_max);
+    lh->strobe.Bytes_max += lh->strobe.COBS_offset + 1;  // header room + end delimiter
+#else
+    lh->strobe.Bytes_max += 3;      // start/end delimiter + COBS code
+#endif
     //strobe.Bytes_total += 3;  // must not include the COBS overhead
 
 // NONE (no encoding) supported
@@ -2333,28 +5159,37 @@ int32_t lasso_hostRegisterMEM (void) {
 
 // add space for CRC to end of response packet (notifications have no CRC)
 #if (LASSO_HOST_COMMAND_CRC_ENABLE == 1)
-    response.Bytes_max += LASSO_HOST_CRC_BYTEWIDTH;
+    lh->response.Bytes_max += LASSO_HOST_CRC_BYTEWIDTH;
 #endif    
 
 // ESCS encoding requires substantial (worst case) overhead
 #if (LASSO_HOST_COMMAND_ENCODING == LASSO_ENCODING_ESCS)
-    response.Bytes_max += 2;    // start and end delimiter
+    lh->response.Bytes_max += 2;    // start and end delimiter
     //response.Bytes_max *= 2;    // worst case (see further below)
 #if (LASSO_HOST_NOTIFICATIONS == 1)
-    notification.Bytes_max += 2;
+    lh->notification.Bytes_max += 2;
     //notification.Bytes_max *= 2;    // worst case (see further below)
 #endif
     
 // COBS encoding always requires constant overhead
 #elif (LASSO_HOST_COMMAND_ENCODING == LASSO_ENCODING_COBS)
-    response.Bytes_max += 3;    // start and end delimiter + COBS code
+#if (LASSO_HOST_COBS_CHUNKED_FRAMES == 0)
+    lh->response.COBS_offset = COBS_HEADER_SIZE(lh->response.Bytes_max);
+    lh->response.Bytes_max += lh->response.COBS_offset + 1;  // header room + end delimiter
+#if (LASSO_HOST_NOTIFICATIONS == 1)
+    lh->notification.COBS_offset = COBS_HEADER_SIZE(lh->notification.Bytes_max);
+    lh->notification.Bytes_max += lh->notification.COBS_offset + 1;
+#endif
+#else
+    lh->response.Bytes_max += 3;    // start and end delimiter + COBS code
 #if (LASSO_HOST_NOTIFICATIONS == 1)
-    notification.Bytes_max += 3;
+    lh->notification.Bytes_max += 3;
+#endif
 #endif
 
 // RN encoding always requires constant overhead (no notifications possible)
 #elif (LASSO_HOST_COMMAND_ENCODING == LASSO_ENCODING_RN)
-    response.Bytes_max += 2;    // two end delimiters
+    lh->response.Bytes_max += 2;    // two end delimiters
 
 // NONE (no encoding) not supported
 #else
@@ -2367,57 +5202,137 @@ int32_t lasso_hostRegisterMEM (void) {
 //-----------------//
 
     // align requirement to system (user) specific boundary (e.g. %4==0)
-    if (strobe.Bytes_max & (LASSO_MEMORY_ALIGN - 1)) {
-        strobe.Bytes_max &= ~(LASSO_MEMORY_ALIGN - 1);
-        strobe.Bytes_max += LASSO_MEMORY_ALIGN;
+    if (lh->strobe.Bytes_max & (LASSO_MEMORY_ALIGN - 1)) {
+        lh->strobe.Bytes_max &= ~(LASSO_MEMORY_ALIGN - 1);
+        lh->strobe.Bytes_max += LASSO_MEMORY_ALIGN;
+    }
+
+    if (lh->response.Bytes_max & (LASSO_MEMORY_ALIGN - 1)) {
+        lh->response.Bytes_max &= ~(LASSO_MEMORY_ALIGN - 1);
+        lh->response.Bytes_max += LASSO_MEMORY_ALIGN;
+    }
+    
+#if (LASSO_HOST_NOTIFICATIONS == 1)    
+    if (lh->notification.Bytes_max & (LASSO_MEMORY_ALIGN - 1)) {
+        lh->notification.Bytes_max &= ~(LASSO_MEMORY_ALIGN - 1);
+        lh->notification.Bytes_max += LASSO_MEMORY_ALIGN;
+    }    
+#endif
+
+    // ESCS uses a special memory allocation scheme (see further below),
+    // unless frames are encoded through the staging window
+    #if (LASSO_HOST_ESCS_WINDOW_SIZE == 0)
+    #if (LASSO_HOST_STROBE_ENCODING == LASSO_ENCODING_ESCS)
+        lh->strobe.Bytes_max *= 2;
+    #endif
+    #if (LASSO_HOST_COMMAND_ENCODING == LASSO_ENCODING_ESCS)
+        lh->response.Bytes_max *= 2;
+    #if (LASSO_HOST_NOTIFICATIONS == 1)
+        lh->notification.Bytes_max *= 2;   
+    #endif
+    #endif
+    #endif
+    
+    // don't allocate if strobe source is an external, user-specified buffer
+    // (or if strobes are transmitted from memory cells by scatter-gather)
+#if (LASSO_HOST_STROBE_SCATTER_GATHER == 1)
+    // worst case: one segment per data cell
+    lh->strobeSegments = (lasso_segment*)lasso_hostAlloc(lh->dataCellCount * sizeof(lasso_segment));
+    if (lh->strobeSegments == NULL) {
+        return ENOMEM;
+    }
+    lasso_hostBuildSegments(lh);
+#elif (LASSO_HOST_STROBE_EXTERNAL_SOURCE == 0)
+#if (LASSO_HOST_STROBE_BUFFERS > 1)
+    for (lh->strobeRingHead = 0; lh->strobeRingHead < LASSO_HOST_STROBE_BUFFERS; lh->strobeRingHead++) {
+        lh->strobeRing[lh->strobeRingHead] = (uint8_t*)lasso_hostAlloc(lh->strobe.Bytes_max + LASSO_STROBE_LEAD(lh->strobe));
+        if (lh->strobeRing[lh->strobeRingHead] == NULL) {
+            return ENOMEM;
+        }
+        lh->strobeRing[lh->strobeRingHead] += LASSO_STROBE_LEAD(lh->strobe);
+    }
+    lh->strobeRingHead = 0;
+    lh->strobe.buffer = lh->strobeRing[0];
+#else
+    lh->strobe.buffer = (uint8_t*)lasso_hostAlloc(lh->strobe.Bytes_max + LASSO_STROBE_LEAD(lh->strobe));
+    if (lh->strobe.buffer == NULL) {
+        return ENOMEM;
+    }
+    lh->strobe.buffer += LASSO_STROBE_LEAD(lh->strobe);
+#endif
+#endif
+
+#if (LASSO_HOST_CAPTURE_SIZE > 0)
+    lh->captureRing = (uint8_t*)lasso_hostAlloc(LASSO_HOST_CAPTURE_SIZE);
+    if (lh->captureRing == NULL) {
+        return ENOMEM;
+    }
+#endif
+
+    lh->response.buffer = (uint8_t*)lasso_hostAlloc(lh->response.Bytes_max);
+    if (lh->response.buffer == NULL) {
+        return ENOMEM;
     }
 
-    if (response.Bytes_max & (LASSO_MEMORY_ALIGN - 1)) {
-        response.Bytes_max &= ~(LASSO_MEMORY_ALIGN - 1);
-        response.Bytes_max += LASSO_MEMORY_ALIGN;
+#if (LASSO_HOST_COMMAND_QUEUE > 1)
+    for (lh->commandQueueIn = 0; lh->commandQueueIn < LASSO_HOST_COMMAND_QUEUE; lh->commandQueueIn++) {
+        lh->commandQueue[lh->commandQueueIn] = (uint8_t*)lasso_hostAlloc(LASSO_HOST_COMMAND_BUFFER_SIZE);
+        if (lh->commandQueue[lh->commandQueueIn] == NULL) {
+            return ENOMEM;
+        }
     }
+    lh->commandQueueIn = 0;
+    lh->receiveBuffer = lh->commandQueue[0];
+#else
+    lh->receiveBuffer = (uint8_t*)lasso_hostAlloc(LASSO_HOST_COMMAND_BUFFER_SIZE);
+    if (lh->receiveBuffer == NULL) {
+        return ENOMEM;
+    }
+#endif
     
-#if (LASSO_HOST_NOTIFICATIONS == 1)    
-    if (notification.Bytes_max & (LASSO_MEMORY_ALIGN - 1)) {
-        notification.Bytes_max &= ~(LASSO_MEMORY_ALIGN - 1);
-        notification.Bytes_max += LASSO_MEMORY_ALIGN;
-    }    
+#if (LASSO_HOST_RECEIVE_RING_SIZE > 0)
+    lh->receiveRing = (uint8_t*)lasso_hostAlloc(LASSO_HOST_RECEIVE_RING_SIZE);
+    if (lh->receiveRing == NULL) {
+        return ENOMEM;
+    }
 #endif
 
-    // ESCS uses a special memory allocation scheme (see further below)
-    #if (LASSO_HOST_STROBE_ENCODING == LASSO_ENCODING_ESCS)
-        strobe.Bytes_max *= 2;
-    #endif
-    #if (LASSO_HOST_COMMAND_ENCODING == LASSO_ENCODING_ESCS)
-        response.Bytes_max *= 2;
-    #if (LASSO_HOST_NOTIFICATIONS == 1)
-        notification.Bytes_max *= 2;   
-    #endif
-    #endif
-    
-    // don't allocate if strobe source is an external, user-specified buffer
-#if (LASSO_HOST_STROBE_EXTERNAL_SOURCE == 0)
-    strobe.buffer = (uint8_t*)LASSO_HOST_MALLOC(strobe.Bytes_max);
-    if (strobe.buffer == NULL) {
+#if (LASSO_HOST_NOTIFICATIONS == 1)
+    lh->notification.buffer = (uint8_t*)lasso_hostAlloc(lh->notification.Bytes_max);
+    if (lh->notification.buffer == NULL) {
         return ENOMEM;
     }
 #endif
 
-    response.buffer = (uint8_t*)LASSO_HOST_MALLOC(response.Bytes_max);
-    if (response.buffer == NULL) {
+#if (LASSO_HOST_NOTIFICATION_QUEUE > 0)
+    lh->logQueue = (logRecord*)lasso_hostAlloc(LASSO_HOST_NOTIFICATION_QUEUE * sizeof(logRecord));
+    if (lh->logQueue == NULL) {
         return ENOMEM;
     }
+    // record k is free for the k-th claim
+    for (lh->logTail = 0; lh->logTail < LASSO_HOST_NOTIFICATION_QUEUE; lh->logTail++) {
+        lh->logQueue[lh->logTail].seq = lh->logTail;
+    }
+    lh->logTail = 0;
+#endif
 
-    receiveBuffer = (uint8_t*)LASSO_HOST_MALLOC(LASSO_HOST_COMMAND_BUFFER_SIZE);
-    if (receiveBuffer == NULL) {
+#if (LASSO_HOST_STROBE_COPY_PLAN == 1)
+    // worst case: one copy operation per data cell
+    lh->copyPlan = (copyOp*)lasso_hostAlloc(lh->dataCellCount * sizeof(copyOp));
+    if (lh->copyPlan == NULL) {
         return ENOMEM;
     }
-    
-#if (LASSO_HOST_NOTIFICATIONS == 1)
-    notification.buffer = (uint8_t*)LASSO_HOST_MALLOC(notification.Bytes_max);
-    if (notification.buffer == NULL) {
+    lasso_hostBuildCopyPlan(lh);
+#endif
+
+#if (LASSO_HOST_DATACELL_INDEX == 1)
+    lh->dataCellTable = (dataCell**)lasso_hostAlloc(lh->dataCellCount * sizeof(dataCell*));
+    lh->dataCellBytepos = (uint32_t*)lasso_hostAlloc(lh->dataCellCount * sizeof(uint32_t));
+    lh->dataCellNames = (nameEntry*)lasso_hostAlloc(lh->dataCellCount * sizeof(nameEntry));
+    if ((lh->dataCellTable == NULL) || (lh->dataCellBytepos == NULL) || (lh->dataCellNames == NULL)) {
         return ENOMEM;
     }
+    lasso_hostBuildIndex(lh);
 #endif
 
     // ESCS uses a special memory allocation scheme:
@@ -2428,13 +5343,22 @@ int32_t lasso_hostRegisterMEM (void) {
     // 4) data is written to upper half of buffer (offset = strobe.Bytes_max)
     // 5) data is encoded to lower half of buffer (offset = 0)
     //    (-> may crush data in upper half of buffer without consequence)
+    // With LASSO_HOST_ESCS_WINDOW_SIZE, frame buffers only hold payload and
+    // all frames share a staging window of two halves instead.
+#if (LASSO_HOST_ESCS_WINDOW_SIZE > 0)
+    lh->escsWindow = (uint8_t*)lasso_hostAlloc(2 * LASSO_HOST_ESCS_WINDOW_SIZE);
+    if (lh->escsWindow == NULL) {
+        return ENOMEM;
+    }
+#else
 #if (LASSO_HOST_STROBE_ENCODING == LASSO_ENCODING_ESCS)
-    strobe.Bytes_max /= 2;
+    lh->strobe.Bytes_max /= 2;
 #endif
 #if (LASSO_HOST_COMMAND_ENCODING == LASSO_ENCODING_ESCS)
-    response.Bytes_max /= 2;
+    lh->response.Bytes_max /= 2;
 #if (LASSO_HOST_NOTIFICATIONS == 1)
-    notification.Bytes_max /= 2;
+    lh->notification.Bytes_max /= 2;
+#endif
 #endif
 #endif
 
@@ -2442,21 +5366,146 @@ int32_t lasso_hostRegisterMEM (void) {
 }
 
 
+#if (LASSO_HOST_ARENA == 1)
+/*!
+ *  \brief  Register user-supplied memory region as Lasso host arena.
+ *
+ *          Replaces the arena and must therefore be called before any
+ *          memory is allocated (before lasso_hostRegisterDataCell()).
+ *          The region start is aligned to LASSO_ARENA_ALIGN.
+ *
+ *  \return Error code
+ */
+int32_t lasso_hostRegisterArena (
+    void* mem,                  //!< start of memory region
+    uint32_t size               //!< size of memory region in Bytes
+) {
+    uint32_t skip;
+
+    if (mem == NULL) {
+        return EINVAL;
+    }
+
+    if (lasso_hostArenaUsed) {
+        return EBUSY;
+    }
+
+    skip = (uint32_t)(-(uintptr_t)mem & (LASSO_ARENA_ALIGN - 1));
+    if (skip > size) {
+        return EINVAL;
+    }
+
+    lasso_hostArenaBase = (uint8_t*)mem + skip;
+    lasso_hostArenaSize = size - skip;
+
+    return 0;
+}
+
+
+/*!
+ *  \brief  Get number of arena Bytes allocated so far.
+ *
+ *          Called after lasso_hostRegisterMEM() (of all instances), this is
+ *          the exact arena size required by the application.
+ *
+ *  \return Number of Bytes used
+ */
+uint32_t lasso_hostGetArenaUsed (void) {
+    return lasso_hostArenaUsed;
+}
+#endif
+
+
+/*!
+ *  \brief  Take a completely received controls frame (fast path).
+ *
+ *          A controls frame has a fixed size (opcode, LASSO_HOST_CONTROLS_SIZE
+ *          payload Bytes and CRC, if enabled). It is handled here instead of
+ *          occupying a command buffer until the next response slot: the re-
+ *          ceive buffer is released at once, the payload is handed to the
+ *          ISR callback in place and kept for lasso_hostDeliverControls().
+ *          Frames failing the CRC check are dropped.
+ *
+ *  \return True if received frame was a controls frame
+ */
+#if (LASSO_HOST_CONTROLS_SIZE > 0)
+static bool lasso_hostReceiveControls (
+    lasso_host_t* lh            //!< Lasso host instance
+) {
+    uint8_t* ctrls = lh->receiveBuffer + 1;
+
+    if ((lh->receiveBuffer[0] != LASSO_HOST_SET_CONTROLS) ||
+    #if (LASSO_HOST_COMMAND_CRC_ENABLE == 1)
+        (lh->receiveValid != 1 + LASSO_HOST_CONTROLS_SIZE + LASSO_HOST_CRC_BYTEWIDTH)) {
+    #else
+        (lh->receiveValid != 1 + LASSO_HOST_CONTROLS_SIZE)) {
+    #endif
+        return false;
+    }
+
+#if (LASSO_HOST_COMMAND_CRC_ENABLE == 1)
+    if (lasso_hostComputeCRC(lh, lh->receiveBuffer, lh->receiveValid) == 0)
+#endif
+    {
+        if (lh->ctlIsrCallback) {
+            lh->ctlIsrCallback(ctrls);
+        }
+        if (lh->ctlCallback) {
+            // triple buffer: written buffer is swapped in, previous swap
+            // buffer is written next; the buffer being delivered is never
+            // touched (latest controls win)
+            uint32_t swap = lh->controlsSwap;
+
+            memcpy(lh->controls[lh->controlsIn], ctrls, LASSO_HOST_CONTROLS_SIZE);
+            while (!LASSO_HOST_CAS(&lh->controlsSwap, &swap, lh->controlsIn | LASSO_CONTROLS_FRESH));
+            lh->controlsIn = (uint8_t)(swap & LASSO_CONTROLS_INDEX);
+        }
+    }
+
+    lh->receiveValid = 0;                   // release receive buffer
+
+    return true;
+}
+
+
+/*!
+ *  \brief  Hand latest received controls to user callback.
+ *
+ *          Called once per tick, independent of the response latency.
+ *
+ *  \return Void
+ */
+static void lasso_hostDeliverControls (
+    lasso_host_t* lh            //!< Lasso host instance
+) {
+    uint32_t swap = lh->controlsSwap;
+
+    if (swap & LASSO_CONTROLS_FRESH) {
+        // swap out fresh buffer, receive path may publish again meanwhile
+        while (!LASSO_HOST_CAS(&lh->controlsSwap, &swap, lh->controlsOut));
+        lh->controlsOut = (uint8_t)(swap & LASSO_CONTROLS_INDEX);
+        lh->ctlCallback(lh->controls[lh->controlsOut]);
+    }
+}
+#endif
+
+
 /*!
  *  \brief  Receive one char from user-supplied serial port.
  *
  *  \return Error code
  */
-int32_t lasso_hostReceiveByte (
+LASSO_API_R int32_t lasso_hostReceiveByte_r (
+    lasso_host_t* lh,           //!< Lasso host instance
     uint8_t b                   //!< char from serial port
 ) {
 #if (LASSO_HOST_COMMAND_ENCODING == LASSO_ENCODING_RN)
-    if (receiveBufferIndex < LASSO_HOST_COMMAND_BUFFER_SIZE) {
+    if (lh->receiveBufferIndex < LASSO_HOST_COMMAND_BUFFER_SIZE) {
         if (b == '\n') {
-            if (receiveBufferIndex == 0) {
+            if (lh->receiveBufferIndex == 0) {
                 return ENODATA;
             }
-            if (receiveBuffer[receiveBufferIndex - 1] == '\r') {
+            if (lh->receiveBuffer[lh->receiveBufferIndex - 1] == '\r') {
                 /*
                 // 1) terminate string by NULL or whitespace character (0x20)
                 //    -> seems unnecessary for sscanf (works with '\r')
@@ -2467,89 +5516,233 @@ int32_t lasso_hostReceiveByte (
                 // 2) CRC check
                 //    -> not used for RN encoding
                 */
-                receiveValid = receiveBufferIndex;
-                lasso_clearReceiveTimeout();
+                lh->receiveValid = lh->receiveBufferIndex;
+                lasso_clearReceiveTimeout(lh);
+            #if (LASSO_HOST_COMMAND_QUEUE > 1)
+                lasso_hostQueueCommand(lh);
+            #endif
                 return 0;
             }
             else {
-                lasso_clearReceiveTimeout();
+                lasso_clearReceiveTimeout(lh);
                 return EILSEQ;     // '\n' not allowed without prior '\r'
             }
         }
 
-        if (receiveValid == 0) {   // only one command to be handled at a time
-            receiveBuffer[receiveBufferIndex++] = b;
-            receiveTimeout = LASSO_HOST_COMMAND_TIMEOUT_TICKS;
+        if (lh->receiveValid == 0) {   // only one command to be handled at a time
+            lh->receiveBuffer[lh->receiveBufferIndex++] = b;
+            lh->receiveTimeout = LASSO_HOST_COMMAND_TIMEOUT_TICKS;
         }
         else {
-            lasso_clearReceiveTimeout();
+            lasso_clearReceiveTimeout(lh);
             return ENOSPC;
         }
     }
     else {
 
 #elif (LASSO_HOST_COMMAND_ENCODING == LASSO_ENCODING_COBS)
-    if (receiveValid == 0) {
-        receiveValid = COBS_decode_inline(b, receiveBuffer, LASSO_HOST_COMMAND_BUFFER_SIZE);
+    if (lh->receiveValid == 0) {
+    #if (LASSO_HOST_MULTI_INSTANCE == 1)
+        lh->receiveValid = COBS_decode_inline_r(&lh->receiveDecoder, b, lh->receiveBuffer, LASSO_HOST_COMMAND_BUFFER_SIZE);
+    #else
+        lh->receiveValid = COBS_decode_inline(b, lh->receiveBuffer, LASSO_HOST_COMMAND_BUFFER_SIZE);
+    #endif
     }
     else {
         return ENOSPC;
     }
 
-    if (receiveValid > LASSO_HOST_COMMAND_BUFFER_SIZE) {  // this is an error condition of COBS_decode_inline
+    if (lh->receiveValid > LASSO_HOST_COMMAND_BUFFER_SIZE) {  // this is an error condition of COBS_decode_inline
 
 #else // ESCS
-    if (receiveValid == 0) {
-        receiveValid = ESCS_decode_inline(b, receiveBuffer, LASSO_HOST_COMMAND_BUFFER_SIZE);
+    if (lh->receiveValid == 0) {
+    #if (LASSO_HOST_MULTI_INSTANCE == 1)
+        lh->receiveValid = ESCS_decode_inline_r(&lh->receiveDecoder, b, lh->receiveBuffer, LASSO_HOST_COMMAND_BUFFER_SIZE);
+    #else
+        lh->receiveValid = ESCS_decode_inline(b, lh->receiveBuffer, LASSO_HOST_COMMAND_BUFFER_SIZE);
+    #endif
     }
     else {
         return ENOSPC;
     }
 
-    if (receiveValid > LASSO_HOST_COMMAND_BUFFER_SIZE) {  // this is an error condition of ESCS_decode_inline
+    if (lh->receiveValid > LASSO_HOST_COMMAND_BUFFER_SIZE) {  // this is an error condition of ESCS_decode_inline
 
 #endif
 
-        lasso_clearReceiveTimeout();
+        lasso_clearReceiveTimeout(lh);
 
         // notify client of receive buffer overflow
-        if (lasso_hostInterpreteCommand(EOVERFLOW)) {
-
-            response.frame = response.buffer;           // load buffer start
-            response.Byte_count = response.Bytes_total; // trigger transmission
-
-        #if (LASSO_HOST_COMMAND_ENCODING == LASSO_ENCODING_COBS)
-            response.COBS_backup = response.buffer[2];
-        #endif
-
-            receiveValid = 0;
-            response.permission = false;                // lock response frame buffer
+        lh->commandBuffer = lh->receiveBuffer;
+        lh->commandValid = lh->receiveValid;
+        if (lasso_hostInterpreteCommand(lh, EOVERFLOW)) {
+            lh->receiveValid = 0;
+            lasso_hostLoadResponse(lh);
         }
         
         return EOVERFLOW;
     }
 
+#if (LASSO_HOST_CONTROLS_SIZE > 0)
+    if ((lh->receiveValid > 0) && lasso_hostReceiveControls(lh)) {
+        return 0;
+    }
+#endif
+
+#if (LASSO_HOST_COMMAND_QUEUE > 1) && (LASSO_HOST_COMMAND_ENCODING != LASSO_ENCODING_RN)
+    if (lh->receiveValid > 0) {
+        lasso_hostQueueCommand(lh);
+    }
+#endif
+
     return 0;
 }
+
+
+/*!
+ *  \brief  Receive a block of chars from user-supplied serial port.
+ *
+ *          Bytes are only copied into a lock-free single-producer/single-
+ *          consumer ring here and decoded later by lasso_hostHandleCOM(), so
+ *          that an RX DMA or IDLE-line interrupt can push whole chunks with
+ *          little ISR load. Must not be mixed with lasso_hostReceiveByte().
+ *
+ *  \return Error code (ENOSPC if the ring could not take all chars)
+ */
+#if (LASSO_HOST_RECEIVE_RING_SIZE > 0)
+LASSO_API_R int32_t lasso_hostReceiveBlock_r (
+    lasso_host_t* lh,           //!< Lasso host instance
+    const uint8_t* src,         //!< chars from serial port (e.g. RX DMA buffer)
+    uint32_t cnt                //!< number of chars
+) {
+    uint32_t head = lh->receiveRingHead;
+    uint32_t space = LASSO_HOST_RECEIVE_RING_SIZE - (head - lh->receiveRingTail);
+    uint32_t n;
+    int32_t err = 0;
+
+    if (lh->receiveRing == NULL) {
+        return EAGAIN;          // lasso_hostRegisterMEM() not called yet
+    }
+
+    if (cnt > space) {
+        cnt = space;            // drop what does not fit
+        err = ENOSPC;
+    }
+
+    // copy in up to two parts (wrap-around)
+    n = LASSO_HOST_RECEIVE_RING_SIZE - (head & (LASSO_HOST_RECEIVE_RING_SIZE - 1));
+    if (n > cnt) {
+        n = cnt;
+    }
+    memcpy(lh->receiveRing + (head & (LASSO_HOST_RECEIVE_RING_SIZE - 1)), src, n);
+    memcpy(lh->receiveRing, src + n, cnt - n);
+
+    lh->receiveRingHead = head + cnt;   // publish Bytes only after copy
+
+    return err;
+}
+
+
+/*!
+ *  \brief  Decode Bytes pending in receive ring.
+ *
+ *          Stops while a received command blocks the receiver, remaining
+ *          Bytes stay in the ring until the command has been handled.
+ *
+ *  \return Void
+ */
+static void lasso_hostDrainReceiveRing (
+    lasso_host_t* lh            //!< Lasso host instance
+) {
+    uint32_t head = lh->receiveRingHead;
+    uint32_t tail = lh->receiveRingTail;
+
+    while ((tail != head) && (lh->receiveValid == 0)) {
+        lasso_hostReceiveByte_r(lh, lh->receiveRing[tail & (LASSO_HOST_RECEIVE_RING_SIZE - 1)]);
+        tail++;
+    }
+
+    lh->receiveRingTail = tail;     // release Bytes to producer
+}
+#endif
     
 
 /*!
  *  \brief  Signal to Lasso host that serial COM has finished transmitting.
  *    
- *   Notes: to be called by user code after transmission of each frame.
+ *   Notes: to be called by user code after transmission of each frame,
+ *          unless the transmit backend polls the transmitter (see
+ *          lasso_hostRegisterTX()).
  *
  *  \return None
  */
-void lasso_hostSignalFinishedCOM(void) {
+LASSO_API_R void lasso_hostSignalFinishedCOM_r (
+    lasso_host_t* lh            //!< Lasso host instance
+) {
     // re-enable frame buffer write access
-    if (lastFrame) {
-        if (lastFrame->Byte_count == 0) {
-            lastFrame->permission = true;                      
+    if (lh->lastFrame) {
+        if (lh->lastFrame->Byte_count == 0) {
+        #if (LASSO_HOST_AUTOTUNE == 1)
+            // strobe transmission time measurement, see lasso_hostAutotune()
+            if ((lh->lastFrame == &lh->strobe) && (!lh->strobe.permission) && (lh->lasso_strobing)) {
+                lh->autotuneDone = lh->autotuneClock;
+                lh->autotuneFinished = true;
+            }
+        #endif
+            lh->lastFrame->permission = true;                      
         }        
     }
 }
 
 
+#if (LASSO_HOST_SNAPSHOT == 1)
+/*!
+ *  \brief  Begin update of a group of data cells (strobe snapshot).
+ *
+ *          Multi-writer seqlock: the publisher count (lower half of the
+ *          snapshot word) is incremented by compare-and-swap, the strobe
+ *          sampler re-copies the data cells as long as it is non-zero or the
+ *          version (upper half) changed while copying. Never blocks, may
+ *          thus be called from ISRs and tasks, also while strobe sampling is
+ *          in progress (lasso_hostHandleCOM() at higher priority or on
+ *          another core).
+ *
+ *  Note 1: Each call must be paired with lasso_hostPublishEnd().
+ *  Note 2: Updates should be short: after LASSO_HOST_SNAPSHOT_RETRIES
+ *          re-copies, the strobe is sent regardless.
+ *  Note 3: The sampler cannot wait for an update it has preempted, i.e.
+ *          publishers should not run at lower priority than
+ *          lasso_hostHandleCOM() on the same core.
+ *
+ *  \return Void
+ */
+LASSO_API_R void lasso_hostPublishBegin_r (
+    lasso_host_t* lh            //!< Lasso host instance
+) {
+    uint32_t seq = lh->snapshotSeq;
+
+    while (!LASSO_HOST_CAS(&lh->snapshotSeq, &seq, seq + 1));
+}
+
+
+/*!
+ *  \brief  End update of a group of data cells (strobe snapshot).
+ *
+ *          Decrements the publisher count and increments the version in a
+ *          single compare-and-swap, see lasso_hostPublishBegin().
+ *
+ *  \return Void
+ */
+LASSO_API_R void lasso_hostPublishEnd_r (
+    lasso_host_t* lh            //!< Lasso host instance
+) {
+    uint32_t seq = lh->snapshotSeq;
+
+    while (!LASSO_HOST_CAS(&lh->snapshotSeq, &seq, seq + 0x10000 - 1));
+}
+#endif
+
+
 #if (LASSO_HOST_NOTIFICATIONS == 1)   
     
 /*!
@@ -2557,8 +5750,10 @@ void lasso_hostSignalFinishedCOM(void) {
 *    
 *  \return True/False
 */
-bool lasso_hostReadyForNotification (void) {
-    return ((!lasso_advertise) && (notification.permission));
+LASSO_API_R bool lasso_hostReadyForNotification_r (
+    lasso_host_t* lh            //!< Lasso host instance
+) {
+    return ((!lh->lasso_advertise) && (lh->notification.permission));
 }
     
     
@@ -2579,6 +5774,7 @@ bool lasso_hostReadyForNotification (void) {
  *  Notes on printf() and _write():
  *  Note 1: printf() outputs to an intermediate buffer if text is not terminated
  *          by '\n' (the newline character acts like a flush)
+ *  Note 2: printf() notifications are sent by the default instance
  *
  *  \return Number of Bytes written to notification buffer
  */
@@ -2587,38 +5783,39 @@ int _write(
     char* ptr,
     int len
 ) {
+    lasso_host_t* lh = &lasso_hostDefault;
     char c = 0;
-    static uint8_t* notificationBuffer = NULL;      
+    uint8_t* notificationBuffer = lh->printfBuffer;
 
     // if advertising, then completely reset notification buffer
-    if (lasso_advertise) {
-        notification.Byte_count = 0;
-        notificationBuffer = NULL;
+    if (lh->lasso_advertise) {
+        lh->notification.Byte_count = 0;
+        lh->printfBuffer = NULL;
         return 0;
     }
     
     // still transmitting?
-    if (!notification.permission) {
+    if (!lh->notification.permission) {
         return 0;
     }    
   
     if (notificationBuffer == NULL) {
-        notificationBuffer = notification.buffer;
+        notificationBuffer = lh->notification.buffer;
         
     #if (LASSO_HOST_COMMAND_ENCODING == LASSO_ENCODING_COBS)
         *notificationBuffer = 0xFF; // indicate that buffer has not been COBS en-
                                     // coded yet, COBS itself places a 0x00 here
-        notificationBuffer += 2;    // access space behind COBS header
+        notificationBuffer += LASSO_COBS_OFFSET(lh->notification);  // access space behind COBS header
     #endif 
     
     #if (LASSO_HOST_COMMAND_ENCODING == LASSO_ENCODING_ESCS)
         *notificationBuffer = 0;    // this will launch the ESCS encoder
-        notificationBuffer += notification.Bytes_max;   // access 2nd half of buffer
+        notificationBuffer += LASSO_ESCS_OFFSET(lh->notification);  // access 2nd half of buffer
     #endif    
     
         // install default notification opcode
         *notificationBuffer++ = LASSO_HOST_SEND_NOTIFICATION;    
-        notification.Bytes_total = 1;
+        lh->notification.Bytes_total = 1;
     }
     
     file = len;    // abuse "file" variable as copy of len
@@ -2629,29 +5826,90 @@ int _write(
         *notificationBuffer++ = (uint8_t)c;
         
         // truncate if required (will create new line in Lasso client)
-        if (++notification.Bytes_total == LASSO_HOST_NOTIFICATION_BUFFER_SIZE) {
+        if (++lh->notification.Bytes_total == LASSO_HOST_NOTIFICATION_BUFFER_SIZE) {
             c = '\n';
             break;
         }        
     }      
 
     if (c == '\n') {
-        notification.frame = notification.buffer;   // load buffer start
-        notification.Byte_count = notification.Bytes_total; // trigger transmission
+        lh->notification.frame = lh->notification.buffer;   // load buffer start
+        lh->notification.Byte_count = lh->notification.Bytes_total; // trigger transmission
         notificationBuffer = NULL; // reset buffer for next line    
         
     #if (LASSO_HOST_COMMAND_ENCODING == LASSO_ENCODING_COBS)
-        notification.COBS_backup = notification.buffer[2];
+        LASSO_COBS_PREPARE(lh->notification);
     #endif    
     
-        notification.permission = false;            // lock notification frame buffer
+        lh->notification.permission = false;            // lock notification frame buffer
     }
+    lh->printfBuffer = notificationBuffer;
     
     return (file - len);
 }    
 #endif
     
 
+/*!
+ *  \brief  Prepare notification frame, install notification opcode.
+ *
+ *  \return Pointer to notification text
+ */
+static uint8_t* lasso_hostOpenNotification (
+    lasso_host_t* lh            //!< Lasso host instance
+) {
+    uint8_t* notificationBuffer = lh->notification.buffer;
+
+#if (LASSO_HOST_COMMAND_ENCODING == LASSO_ENCODING_COBS)
+    *notificationBuffer = 0xFF; // indicate that buffer has not been COBS en-
+                                // coded yet, COBS itself places a 0x00 here
+    notificationBuffer += LASSO_COBS_OFFSET(lh->notification);  // access space behind COBS header
+#endif
+
+#if (LASSO_HOST_COMMAND_ENCODING == LASSO_ENCODING_ESCS)
+    *notificationBuffer = 0;             // this will launch the ESCS encoder
+    notificationBuffer += LASSO_ESCS_OFFSET(lh->notification);  // access 2nd half of buffer
+#endif
+        
+    // install default notification opcode
+    *notificationBuffer++ = LASSO_HOST_SEND_NOTIFICATION;
+
+    return notificationBuffer;
+}
+
+
+/*!
+ *  \brief  Trigger transmission of notification frame.
+ *
+ *  \return Void
+ */
+static void lasso_hostLoadNotification (
+    lasso_host_t* lh,                       //!< Lasso host instance
+    uint8_t* notificationBuffer             //!< end of notification text
+) {
+    lh->notification.Bytes_total = notificationBuffer - lh->notification.buffer;
+    
+// correct transmission length for COBS
+#if (LASSO_HOST_COMMAND_ENCODING == LASSO_ENCODING_COBS)
+    lh->notification.Bytes_total -= LASSO_COBS_OFFSET(lh->notification);    // COBS header does not count as payload Bytes
+#endif
+
+// correct transmission length for ESCS
+#if (LASSO_HOST_COMMAND_ENCODING == LASSO_ENCODING_ESCS)
+    lh->notification.Bytes_total -= LASSO_ESCS_OFFSET(lh->notification);    // correct initial offset
+#endif        
+
+    lh->notification.frame = lh->notification.buffer;           // load buffer start
+    lh->notification.Byte_count = lh->notification.Bytes_total; // trigger transmission    
+
+#if (LASSO_HOST_COMMAND_ENCODING == LASSO_ENCODING_COBS)
+    LASSO_COBS_PREPARE(lh->notification);
+#endif
+
+    lh->notification.permission = false;                    // lock notification frame buffer
+}
+
+
 /*!
  *  \brief  Send a notification to Lasso client.
  *
@@ -2664,64 +5922,212 @@ int _write(
  *
  *  \return Error code
  */
-int32_t lasso_hostSendNotification (
+LASSO_API_R int32_t lasso_hostSendNotification_r (
+    lasso_host_t* lh,           //!< Lasso host instance
     const char* msg             //!< notification string
 ) { 
     // advertising?
-    if (lasso_advertise) {
+    if (lh->lasso_advertise) {
         return EBUSY;
     }
     
     // still transmitting?
-    if (!notification.permission) {
+    if (!lh->notification.permission) {
         return EBUSY;
     }
 
-    uint8_t* notificationBuffer = notification.buffer;
+    uint8_t* notificationBuffer = lasso_hostOpenNotification(lh);
     size_t len = strlen(msg);
     
     if (len >= LASSO_HOST_NOTIFICATION_BUFFER_SIZE) {
         len = LASSO_HOST_NOTIFICATION_BUFFER_SIZE - 1;  // discount opcode
     }
-    
-#if (LASSO_HOST_COMMAND_ENCODING == LASSO_ENCODING_COBS)
-    *notificationBuffer = 0xFF; // indicate that buffer has not been COBS en-
-                                // coded yet, COBS itself places a 0x00 here
-    notificationBuffer += 2;    // access space behind COBS header
-#endif
 
-#if (LASSO_HOST_COMMAND_ENCODING == LASSO_ENCODING_ESCS)
-    *notificationBuffer = 0;             // this will launch the ESCS encoder
-    notificationBuffer += notification.Bytes_max;// access 2nd half of buffer
-#endif
-        
-    // install default notification opcode
-    *notificationBuffer++ = LASSO_HOST_SEND_NOTIFICATION;
+    // copy excluding \0 string terminator
+    memcpy((void*)notificationBuffer, (const void*)msg, len);        
+
+    lasso_hostLoadNotification(lh, notificationBuffer + len);
+
+    return 0;    
+}
+
+
+#if (LASSO_HOST_NOTIFICATION_QUEUE > 0)
+/*!
+ *  \brief  Queue a notification for deferred formatting.
+ *
+ *          Lock-free multi-producer queue (bounded, sequence number per
+ *          record): a producer claims the next record by compare-and-swap
+ *          on the queue head, fills it and publishes it by its sequence
+ *          number. May thus be called from ISRs and tasks concurrently,
+ *          formatting costs are spent in lasso_hostHandleCOM().
+ *
+ *  Note 1: Format strings are referenced, not copied (must be static).
+ *  Note 2: Conversions %d, %i, %u, %x, %X, %c and %% are supported.
+ *  Note 3: If the queue is full, the notification is dropped and counted,
+ *          a notification reporting the count follows later.
+ *
+ *  \return Error code
+ */
+LASSO_API_R int32_t lasso_hostLog_r (
+    lasso_host_t* lh,           //!< Lasso host instance
+    const char* fmt,            //!< static format string
+    uint32_t a0,                //!< 1st argument
+    uint32_t a1,                //!< 2nd argument
+    uint32_t a2                 //!< 3rd argument
+) {
+    logRecord* r;
+    uint32_t pos;
+    uint32_t seq;
+
+    if (lh->logQueue == NULL) {
+        return EBUSY;           // lasso_hostRegisterMEM() not called yet
+    }
+
+    pos = lh->logHead;
+    for (;;) {
+        r = &lh->logQueue[pos & (LASSO_HOST_NOTIFICATION_QUEUE - 1)];
+        seq = r->seq;
+        if (seq == pos) {
+            // record free: claim it (on failure, pos is reloaded with head)
+            if (LASSO_HOST_CAS(&lh->logHead, &pos, pos + 1)) {
+                break;
+            }
+        }
+        else if ((int32_t)(seq - pos) < 0) {
+            // record not yet sent: queue full
+            seq = lh->logDropped;
+            while (!LASSO_HOST_CAS(&lh->logDropped, &seq, seq + 1));
+            return ENOBUFS;
+        }
+        else {
+            pos = lh->logHead;  // record claimed by other producer meanwhile
+        }
+    }
+
+    r->fmt    = fmt;
+    r->arg[0] = a0;
+    r->arg[1] = a1;
+    r->arg[2] = a2;
+
+    LASSO_HOST_BARRIER();       // record complete before it is published
+    r->seq = pos + 1;
+
+    return 0;
+}
+
+
+/*!
+ *  \brief  Format a queued notification.
+ *
+ *  \return Pointer behind formatted text
+ */
+static uint8_t* lasso_hostFormatLog (
+    uint8_t* dest,                          //!< notification text
+    const char* fmt,                        //!< format string
+    const uint32_t* arg                     //!< 3 arguments
+) {
+    uint8_t* end = dest + LASSO_HOST_NOTIFICATION_BUFFER_SIZE - 1;  // discount opcode
+    const char* hex;
+    char digits[10];
+    char c;
+    uint32_t value;
+    uint8_t base;
+    uint8_t n;
+    uint8_t k = 0;
+
+    while (*fmt && (dest < end)) {
+        c = *fmt++;
+        if ((c != '%') || (*fmt == 0)) {
+            *dest++ = (uint8_t)c;
+            continue;
+        }
+
+        c = *fmt++;
+        hex = "0123456789abcdef";
+        switch (c) {
+            case 'd': case 'i': case 'u': base = 10; break;
+            case 'X': hex = "0123456789ABCDEF"; base = 16; break;
+            case 'x': base = 16; break;
+            case 'c': base = 0; break;
+            default : {
+                // "%%" or unsupported conversion: copy as is
+                if (c != '%') {
+                    *dest++ = '%';
+                }
+                if (dest < end) {
+                    *dest++ = (uint8_t)c;
+                }
+                continue;
+            }
+        }
+
+        value = (k < 3) ? arg[k++] : 0;
+        if (base == 0) {
+            *dest++ = (uint8_t)value;
+            continue;
+        }
+        if (((c == 'd') || (c == 'i')) && ((int32_t)value < 0)) {
+            *dest++ = '-';
+            value = 0 - value;
+        }
 
-    // copy excluding \0 string terminator
-    memcpy((void*)notificationBuffer, (const void*)msg, len);        
-    notificationBuffer += len;
-    
-    notification.Bytes_total = notificationBuffer - notification.buffer;
-    
-// correct transmission length for COBS
-#if (LASSO_HOST_COMMAND_ENCODING == LASSO_ENCODING_COBS)
-    notification.COBS_backup = notification.buffer[2];
-    notification.Bytes_total -= 2;  // COBS header does not count as payload Bytes    
-#endif
+        n = 0;
+        do {
+            digits[n++] = hex[value % base];
+            value /= base;
+        } while (value);
+        while (n && (dest < end)) {
+            *dest++ = (uint8_t)digits[--n];
+        }
+    }
 
-// correct transmission length for ESCS
-#if (LASSO_HOST_COMMAND_ENCODING == LASSO_ENCODING_ESCS)
-    notification.Bytes_total -= notification.Bytes_max; // correct initial offset
-#endif        
+    return dest;
+}
+
+
+/*!
+ *  \brief  Send next queued notification, if notification frame is free.
+ *
+ *  \return Void
+ */
+static void lasso_hostDrainLog (
+    lasso_host_t* lh            //!< Lasso host instance
+) {
+    logRecord* r;
+    const char* fmt;
+    uint32_t arg[3];
 
-    notification.frame = notification.buffer;           // load buffer start
-    notification.Byte_count = notification.Bytes_total; // trigger transmission    
+    if ((lh->logQueue == NULL) || lh->lasso_advertise || !lh->notification.permission) {
+        return;
+    }
 
-    notification.permission = false;                    // lock notification frame buffer
+    r = &lh->logQueue[lh->logTail & (LASSO_HOST_NOTIFICATION_QUEUE - 1)];
+    if (r->seq == lh->logTail + 1) {
+        LASSO_HOST_BARRIER();   // record published before it is read
+        fmt    = r->fmt;
+        arg[0] = r->arg[0];
+        arg[1] = r->arg[1];
+        arg[2] = r->arg[2];
+        LASSO_HOST_BARRIER();   // record read before it is released
+
+        // record free for the claim one round later
+        r->seq = lh->logTail + LASSO_HOST_NOTIFICATION_QUEUE;
+        lh->logTail++;
+    }
+    else if (lh->logDropped) {
+        // queue drained: report notifications lost to a full queue
+        arg[0] = lh->logDropped;
+        while (!LASSO_HOST_CAS(&lh->logDropped, &arg[0], 0));
+        fmt = "%u notifications dropped";
+    }
+    else {
+        return;
+    }
 
-    return 0;    
+    lasso_hostLoadNotification(lh, lasso_hostFormatLog(lasso_hostOpenNotification(lh), fmt, arg));
 }
+#endif
 #else
 #if (LASSO_HOST_NOTIFICATION_USE_PRINTF == 1)      
 int _write(
@@ -2746,10 +6152,11 @@ int32_t lasso_hostSendNotification (
  *
  *  \return Void
  */
-void lasso_hostSetBuffer (
+LASSO_API_R void lasso_hostSetBuffer_r (
+    lasso_host_t* lh,       //!< Lasso host instance
     uint8_t* buffer         //!< external buffer pointer
 ) {
-    strobe.buffer = buffer;
+    lh->strobe.buffer = buffer;
 }
 
 
@@ -2758,14 +6165,15 @@ void lasso_hostSetBuffer (
  *
  *  \return Void
  */
-void lasso_hostCountdown (
+LASSO_API_R void lasso_hostCountdown_r (
+    lasso_host_t* lh,       //!< Lasso host instance
     uint16_t count          //!< cycle counts to subtract from countdown
 ) {
-    if (count > strobe.countdown) {
-        strobe.countdown = 0;
+    if (count > lh->strobe.countdown) {
+        lh->strobe.countdown = 0;
     }
     else {
-        strobe.countdown -= count;
+        lh->strobe.countdown -= count;
     }
 }
 
@@ -2779,17 +6187,18 @@ void lasso_hostCountdown (
  *
  *  \return Void
  */
-void lasso_hostTickPeriod (
+LASSO_API_R void lasso_hostTickPeriod_r (
+    lasso_host_t* lh,       //!< Lasso host instance
     float period            //!< new tick period in [ms]
 ) {
-    lasso_tick_period = (uint16_t)period;
+    lh->lasso_tick_period = (uint16_t)period;
 
-    lasso_advertise_period_ticks = (uint16_t)ceilf(LASSO_HOST_ADVERTISE_PERIOD_MS/(float)lasso_tick_period);
+    lh->lasso_advertise_period_ticks = (uint16_t)ceilf(LASSO_HOST_ADVERTISE_PERIOD_MS/(float)lh->lasso_tick_period);
 
     // roundtrip latency calculus explained at beginning of file
-    lasso_roundtrip_latency_ticks = (uint16_t)ceilf(((LASSO_HOST_COMMAND_BUFFER_SIZE + \
+    lh->lasso_roundtrip_latency_ticks = (uint16_t)ceilf(((LASSO_HOST_COMMAND_BUFFER_SIZE + \
                                                LASSO_HOST_RESPONSE_BUFFER_SIZE) * 10 * 1000) \
-                                              /LASSO_HOST_BAUDRATE/(float)lasso_tick_period + \
+                                              /LASSO_HOST_BAUDRATE/(float)lh->lasso_tick_period + \
                                                LASSO_HOST_RESPONSE_LATENCY_TICKS) + 1;
 }
 
@@ -2802,92 +6211,189 @@ void lasso_hostTickPeriod (
  *
  *  \return Void
  */
-void lasso_hostHandleCOM (void)
+LASSO_API_R void lasso_hostHandleCOM_r (
+    lasso_host_t* lh            //!< Lasso host instance
+)
 {
+#if (LASSO_HOST_PERF_COUNTERS == 1)
+    uint32_t cycles;
+#endif
+
     // verify memory allocation of receiveBuffer; if not allocated,
     // lasso_hostRegisterMEM() has not been called yet
-    if (receiveBuffer == NULL) {
+    if (lh->receiveBuffer == NULL) {
         return;
     }
 
+#if (LASSO_HOST_AUTOTUNE == 1)
+    lh->autotuneClock++;
+#endif
+
     // reset command reception in case of timeout
-    if (receiveTimeout > 0) {
-        if (--receiveTimeout == 0) {
-            receiveBufferIndex = 0;
+    if (lh->receiveTimeout > 0) {
+        if (--lh->receiveTimeout == 0) {
+            lh->receiveBufferIndex = 0;
         }
     }
 
+    // transmit backend without completion ISR -> poll transmitter instead
+    if ((lh->txIdle) && (lh->txIdle())) {
+        lasso_hostSignalFinishedCOM_r(lh);
+    }
+
+#if (LASSO_HOST_RECEIVE_RING_SIZE > 0)
+    // decode Bytes received by lasso_hostReceiveBlock() since last call
+    lasso_hostDrainReceiveRing(lh);
+#endif
+
+#if (LASSO_HOST_CONTROLS_SIZE > 0)
+    // controls are delivered on every tick, not on the response cadence
+    lasso_hostDeliverControls(lh);
+#endif
+
     // broadcast (advertise) signature as long as not connected to lasso client
-    if (lasso_advertise) {
-        strobe.countdown--;
-        if (strobe.countdown == 0) {
-            strobe.countdown = lasso_advertise_period_ticks;
-
-            if (strobe.permission) {
-                strobe.frame = (uint8_t*)&lasso_signature;      // load buffer start
-                strobe.Byte_count = sizeof(lasso_signature);    // load Byte count
+    if (lh->lasso_advertise) {
+        lh->strobe.countdown--;
+        if (lh->strobe.countdown == 0) {
+            lh->strobe.countdown = lh->lasso_advertise_period_ticks;
+
+            if (lh->strobe.permission) {
+                lh->strobe.frame = (uint8_t*)&lasso_signature;      // load buffer start
+                lh->strobe.Byte_count = sizeof(lasso_signature);    // load Byte count
                 
-                strobe.permission = false;
+                lh->strobe.permission = false;
             }
         }
     }
     else
 
-    if (lasso_strobing) {
+#if (LASSO_HOST_CAPTURE_SIZE > 0)
+    // capture ring suspends regular strobing until burst has been sent
+    if (lh->captureState != LASSO_CAPTURE_IDLE) {
+        lasso_hostCapture(lh);
+    }
+    else
+#endif
+
+    if (lh->lasso_strobing) {
     #if (LASSO_HOST_STROBE_EXTERNAL_SYNC == 0)
-        strobe.countdown--;
+        lh->strobe.countdown--;
     #endif
-        if (strobe.countdown == 0) {
-            strobe.countdown = lasso_strobe_period;
+        if (lh->strobe.countdown == 0) {
+        #if (LASSO_HOST_AUTOTUNE == 1)
+            lasso_hostAutotune(lh);
+        #endif
+            lh->strobe.countdown = lh->lasso_strobe_period;
 
-            if (strobe.permission) {
-                lasso_hostSampleDataCells();
+        #if (LASSO_HOST_STROBE_BUFFERS > 1)
+            // sample into idle ring buffer, transmission is started further below
+            if (lh->strobeRingQueued + lh->strobeRingBusy < LASSO_HOST_STROBE_BUFFERS) {
+                lh->strobe.buffer = lh->strobeRing[lh->strobeRingHead];
+                lasso_hostSampleDataCells(lh);
+                lh->strobeRingBytes[lh->strobeRingHead] = lh->strobe.Bytes_total;
 
-                strobe.frame = strobe.buffer;           // load buffer start
-                strobe.Byte_count = strobe.Bytes_total; // trigger transmission
+                if (++lh->strobeRingHead == LASSO_HOST_STROBE_BUFFERS) {
+                    lh->strobeRingHead = 0;
+                }
+                lh->strobeRingQueued++;
+            }
+            else {
+                // all buffers queued or transmitting -> signal overdrive
+                lh->lasso_overdrive = 1;
+                LASSO_PERF_INC(LASSO_PERF_STROBES_SKIPPED);
+            }
+        #else
+            if (lh->strobe.permission) {
+            #if (LASSO_HOST_STROBE_SCATTER_GATHER == 1)
+            #if (LASSO_HOST_TIMESTAMP_TIMER == 1)
+                lasso_hostLatchTimestamp(lh);
+            #endif
+                lh->strobe.frame = NULL;                    // no buffer, see strobeSegments
+            #else
+                lasso_hostSampleDataCells(lh);
+
+                lh->strobe.frame = lh->strobe.buffer;           // load buffer start
+            #endif
+                lh->strobe.Byte_count = lh->strobe.Bytes_total; // trigger transmission
+            #if (LASSO_HOST_AUTOTUNE == 1)
+                lh->autotuneStart = lh->autotuneClock;
+            #endif
 
             #if (LASSO_HOST_STROBE_ENCODING == LASSO_ENCODING_COBS)
-                strobe.COBS_backup = strobe.buffer[2];  // save Byte crushed by
-                                                        // future COBS encoding
+                LASSO_COBS_PREPARE(lh->strobe);             // see LASSO_COBS_PREPARE()
             #endif
             
-                strobe.permission = false;              // lock strobe frame buffer  
+                lh->strobe.permission = false;              // lock strobe frame buffer  
             }
             else {                
                 // still tranmitting? -> signal overdrive
-                lasso_overdrive = 1;
+                lh->lasso_overdrive = 1;
+                LASSO_PERF_INC(LASSO_PERF_STROBES_SKIPPED);
             }
+        #endif
         }
     }
 
-    response.countdown--;
-    if (response.countdown == 0) {
-        response.countdown = (uint16_t)(LASSO_HOST_RESPONSE_LATENCY_TICKS);
+#if (LASSO_HOST_STROBE_BUFFERS > 1)
+    lasso_hostLoadStrobeRing(lh);
+#endif
+
+#if (LASSO_HOST_COMMAND_QUEUE > 1) || (LASSO_HOST_COMMAND_BATCH == 1)
+    // pipelined commands pending? -> serve them as soon as response frame is free
+    #if (LASSO_HOST_COMMAND_BATCH == 1)
+    if (lh->batchRemaining > 0) {
+        lh->response.countdown = 1;
+    }
+    #endif
+    #if (LASSO_HOST_COMMAND_QUEUE > 1)
+    if (lh->commandQueueIn != lh->commandQueueOut) {
+        lh->response.countdown = 1;
+    }
+    #endif
+#endif
 
-        if (response.permission) {
-            if (receiveValid > 0) {
+    lh->response.countdown--;
+    if (lh->response.countdown == 0) {
+        lh->response.countdown = (uint16_t)(LASSO_HOST_RESPONSE_LATENCY_TICKS);
+
+        if (lh->response.permission) {
+        #if (LASSO_HOST_COMMAND_BATCH == 1)
+            // sub-commands of batch are handled before further queued commands
+            if (lh->batchRemaining > 0) {
+                lasso_hostNextBatchCommand(lh);
+            #if (LASSO_HOST_PERF_COUNTERS == 1)
+                cycles = LASSO_HOST_PERF_CYCLES();
+            #endif
+                if (lasso_hostInterpreteCommand(lh, 0)) {
+                    lasso_hostLoadResponse(lh);
+                }
+            #if (LASSO_HOST_PERF_COUNTERS == 1)
+                lasso_hostPerfCycles(lh, LASSO_PERF_COMMAND_CYCLES, cycles);
+            #endif
+            }
+            else
+        #endif
+            if (lasso_hostPeekCommand(lh)) {
                 #if (LASSO_HOST_COMMAND_CRC_ENABLE == 1)
-                if (crcCallback(receiveBuffer, receiveValid) == 0) {
+                if (lasso_hostComputeCRC(lh, lh->commandBuffer, lh->commandValid) == 0) {
                 #else
                 {
                 #endif
-                    if (receiveBuffer[0] == LASSO_HOST_SET_CONTROLS) {
-                        if (ctlCallback) {
-                            ctlCallback(&receiveBuffer[1]);
+                    if (lh->commandBuffer[0] == LASSO_HOST_SET_CONTROLS) {
+                        if (lh->ctlCallback) {
+                            lh->ctlCallback(&lh->commandBuffer[1]);
                         }
                     }
                     else {
-                        if (lasso_hostInterpreteCommand(0)) {
-
-                            response.frame = response.buffer;           // load buffer start
-                            response.Byte_count = response.Bytes_total; // trigger transmission
-
-                        #if (LASSO_HOST_COMMAND_ENCODING == LASSO_ENCODING_COBS)
-                            response.COBS_backup = response.buffer[2];
-                        #endif
-                    
-                            response.permission = false;    // lock response frame buffer                     
+                    #if (LASSO_HOST_PERF_COUNTERS == 1)
+                        cycles = LASSO_HOST_PERF_CYCLES();
+                    #endif
+                        if (lasso_hostInterpreteCommand(lh, 0)) {
+                            lasso_hostLoadResponse(lh);
                         }
+                    #if (LASSO_HOST_PERF_COUNTERS == 1)
+                        lasso_hostPerfCycles(lh, LASSO_PERF_COMMAND_CYCLES, cycles);
+                    #endif
                     }
                 }
                 #if (LASSO_HOST_COMMAND_CRC_ENABLE == 1)
@@ -2896,28 +6402,313 @@ void lasso_hostHandleCOM (void)
                 }
                 #endif
 
-                receiveValid = 0;             
+                lasso_hostReleaseCommand(lh);
             }
         }
     }
 
+#if (LASSO_HOST_NOTIFICATION_QUEUE > 0)
+    // queued notifications are formatted here, outside of the caller
+    lasso_hostDrainLog(lh);
+#endif
+
+#if (LASSO_HOST_LINK_SCHEDULER == LASSO_LINK_WEIGHTED)
+    // frames are sent according to their link shares
+    lasso_hostScheduleLink(lh);
+#else
     // 1) responses frames are sent only if no strobe is being sent
     // 2) the first free slot after a strobe is assigned to a response frame
     // 3) notifications are only sent if not busy with strobe or response frames
-    if (strobe.Byte_count > 0) {
-        lasso_hostTransmitDataFrame(&strobe);
+    // 4) a frame streamed through the ESCS staging window is always completed
+#if (LASSO_HOST_ESCS_WINDOW_SIZE > 0)
+    if (lh->escsOwner) {
+        lasso_hostTransmitESCS(lh, lh->escsOwner);
+    }
+    else
+#endif
+    if (lh->strobe.Byte_count > 0) {
+        lasso_hostTransmitDataFrame(lh, &lh->strobe);
     }
-    else if (response.Byte_count > 0) {
-        lasso_hostTransmitDataFrame(&response);        
+    else if (lh->response.Byte_count > 0) {
+        lasso_hostTransmitDataFrame(lh, &lh->response);        
     }        
 #if (LASSO_HOST_NOTIFICATIONS == 1)        
-    else if (notification.Byte_count > 0) {
-        lasso_hostTransmitDataFrame(&notification);
+    else if (lh->notification.Byte_count > 0) {
+        lasso_hostTransmitDataFrame(lh, &lh->notification);
     }
 #endif        
+#endif
 
+#if (LASSO_HOST_TIMESTAMP_TIMER == 1)
+    if (lh->timerCallback) {
+        lasso_hostReadTimer(lh);          // track wrap-arounds between strobes
+    }
+    else
+#endif
 #if (LASSO_HOST_TIMESTAMP == 1)
-    lasso_timestamp++;
+    lh->lasso_timestamp++;
+#endif
+}
+
+
+#if (LASSO_HOST_MULTI_INSTANCE == 1)
+
+//--------------//
+// Instance API //
+//--------------//
+
+/*!
+ *  \brief  Create an additional Lasso host instance.
+ *
+ *          The instance is initialized like the default instance and must
+ *          be set up with the lasso_hostXxx_r() functions, in the same order
+ *          as the default instance (RegisterCOM, RegisterDataCell...,
+ *          RegisterMEM).
+ *
+ *  \return Pointer to new instance, NULL if out of memory
+ */
+lasso_host_t* lasso_hostCreate (void) {
+    static const lasso_host_t lasso_hostTemplate = LASSO_HOST_INSTANCE_INIT;
+    lasso_host_t* h = (lasso_host_t*)lasso_hostAlloc(sizeof(lasso_host_t));
+
+    if (h) {
+        *h = lasso_hostTemplate;
+    }
+
+    return h;
+}
+#endif
+
+
+//----------------------//
+// Default instance API //
+//----------------------//
+
+// Each lasso_hostXxx() function serves the default instance by passing it
+// to lasso_hostXxx_r().
+
+int32_t lasso_hostRegisterCOM (
+    lasso_comSetup cS,          //!< user-supplied function to setup serial COM
+    lasso_comCallback cC,       //!< user-supplied callback on COM transmission
+    lasso_actCallback aC,       //!< user-supplied callback on strobe activation
+#if (LASSO_HOST_STROBE_CRC_ENABLE == 1) || (LASSO_HOST_COMMAND_CRC_ENABLE == 1)
+    lasso_perCallback pC,       //!< user-supplied callback on period change
+    lasso_crcCallback rC        //!< user-supplied CRC generator
+#else
+    lasso_perCallback pC        //!< user-supplied callback on period change
+#endif
+) {
+    #if (LASSO_HOST_STROBE_CRC_ENABLE == 1) || (LASSO_HOST_COMMAND_CRC_ENABLE == 1)
+    return lasso_hostRegisterCOM_r(&lasso_hostDefault, cS, cC, aC, pC, rC);
+    #else
+    return lasso_hostRegisterCOM_r(&lasso_hostDefault, cS, cC, aC, pC);
+    #endif
+}
+
+
+int32_t lasso_hostRegisterTX (
+    const lasso_txBackend* tx,  //!< transmit backend of target
+    lasso_actCallback aC,       //!< user-supplied callback on strobe activation
+#if (LASSO_HOST_STROBE_CRC_ENABLE == 1) || (LASSO_HOST_COMMAND_CRC_ENABLE == 1)
+    lasso_perCallback pC,       //!< user-supplied callback on period change
+    lasso_crcCallback rC        //!< user-supplied CRC generator
+#else
+    lasso_perCallback pC        //!< user-supplied callback on period change
+#endif
+) {
+    #if (LASSO_HOST_STROBE_CRC_ENABLE == 1) || (LASSO_HOST_COMMAND_CRC_ENABLE == 1)
+    return lasso_hostRegisterTX_r(&lasso_hostDefault, tx, aC, pC, rC);
+    #else
+    return lasso_hostRegisterTX_r(&lasso_hostDefault, tx, aC, pC);
+    #endif
+}
+
+
+int32_t lasso_hostRegisterCMDRX (
+    lasso_cmdCallback cC            //!< user-supplied CMDRX function
+) {
+    return lasso_hostRegisterCMDRX_r(&lasso_hostDefault, cC);
+}
+
+
+int32_t lasso_hostRegisterCTRLS (
+    lasso_ctlCallback cC            //!< user-supplied CTRLS function
+) {
+    return lasso_hostRegisterCTRLS_r(&lasso_hostDefault, cC);
+}
+
+
+#if (LASSO_HOST_CONTROLS_SIZE > 0)
+int32_t lasso_hostRegisterCTRLSISR (
+    lasso_ctlCallback cC            //!< user-supplied CTRLS function
+) {
+    return lasso_hostRegisterCTRLSISR_r(&lasso_hostDefault, cC);
+}
+#endif
+
+
+#if (LASSO_HOST_STROBE_CRC_ENABLE == 1) || (LASSO_HOST_COMMAND_CRC_ENABLE == 1)
+int32_t lasso_hostRegisterCRC (
+    lasso_crcUpdateCallback uC      //!< user-supplied incremental CRC function
+) {
+    return lasso_hostRegisterCRC_r(&lasso_hostDefault, uC);
+}
+#endif
+
+
+#if (LASSO_HOST_MEMCPY_MIN_BYTES > 0)
+int32_t lasso_hostRegisterMEMCPY (
+    lasso_memcpyCallback mC         //!< user-supplied MEMCPY function
+) {
+    return lasso_hostRegisterMEMCPY_r(&lasso_hostDefault, mC);
+}
+#endif
+
+
+#if (LASSO_HOST_TIMESTAMP_TIMER == 1)
+int32_t lasso_hostRegisterTIMER (
+    lasso_timerCallback tC          //!< user-supplied timer read function
+) {
+    return lasso_hostRegisterTIMER_r(&lasso_hostDefault, tC);
+}
+#endif
+
+
+#if (LASSO_HOST_STROBE_SCATTER_GATHER == 1)
+int32_t lasso_hostRegisterSG (
+    lasso_sgCallback sC             //!< user-supplied SG function
+) {
+    return lasso_hostRegisterSG_r(&lasso_hostDefault, sC);
+}
+#endif
+
+
+#if (LASSO_HOST_CAPTURE_SIZE > 0)
+int32_t lasso_hostRegisterTRIG (
+    lasso_trgCallback tC            //!< user-supplied trigger function
+) {
+    return lasso_hostRegisterTRIG_r(&lasso_hostDefault, tC);
+}
+#endif
+
+
+#if (LASSO_HOST_DATASPACE_STATIC == 0)
+int32_t lasso_hostRegisterDataCell (
+    uint16_t type,                      //!< memory cell type
+    uint16_t count,                     //!< array size
+    const void* ptr,                    //!< pointer to memory cell
+    const char* const name,             //!< identifier string
+    const char* const unit,             //!< unit string
+#if (LASSO_HOST_STROBE_DYNAMICS == LASSO_STROBE_STATIC)
+    const lasso_chgCallback onChange    //!< user callback for change event
+#else
+    const lasso_chgCallback onChange,   //!< user callback for change event
+    uint16_t update_rate                //!< update rate info
+#endif
+) {
+    #if (LASSO_HOST_STROBE_DYNAMICS == LASSO_STROBE_STATIC)
+    return lasso_hostRegisterDataCell_r(&lasso_hostDefault, type, count, ptr, name, unit, onChange);
+    #else
+    return lasso_hostRegisterDataCell_r(&lasso_hostDefault, type, count, ptr, name, unit, onChange, update_rate);
+    #endif
+}
+#else
+int32_t lasso_hostRegisterDataspace (
+    const lasso_dataCell* table,        //!< data cells, see LASSO_DATACELL()
+    uint8_t count                       //!< number of data cells in table
+) {
+    return lasso_hostRegisterDataspace_r(&lasso_hostDefault, table, count);
+}
+#endif
+
+
+int32_t lasso_hostRegisterMEM (void) {
+    return lasso_hostRegisterMEM_r(&lasso_hostDefault);
+}
+
+
+int32_t lasso_hostReceiveByte (
+    uint8_t b                   //!< char from serial port
+) {
+    return lasso_hostReceiveByte_r(&lasso_hostDefault, b);
+}
+
+
+#if (LASSO_HOST_RECEIVE_RING_SIZE > 0)
+int32_t lasso_hostReceiveBlock (
+    const uint8_t* src,         //!< chars from serial port
+    uint32_t cnt                //!< number of chars
+) {
+    return lasso_hostReceiveBlock_r(&lasso_hostDefault, src, cnt);
+}
+#endif
+
+
+#if (LASSO_HOST_SNAPSHOT == 1)
+void lasso_hostPublishBegin (void) {
+    lasso_hostPublishBegin_r(&lasso_hostDefault);
+}
+
+
+void lasso_hostPublishEnd (void) {
+    lasso_hostPublishEnd_r(&lasso_hostDefault);
+}
+#endif
+
+
+#if (LASSO_HOST_NOTIFICATIONS == 1)
+int32_t lasso_hostSendNotification (
+    const char* msg             //!< notification string
+) {
+    return lasso_hostSendNotification_r(&lasso_hostDefault, msg);
+}
+
+
+#if (LASSO_HOST_NOTIFICATION_QUEUE > 0)
+int32_t lasso_hostLog (
+    const char* fmt,            //!< static format string
+    uint32_t a0,                //!< 1st argument
+    uint32_t a1,                //!< 2nd argument
+    uint32_t a2                 //!< 3rd argument
+) {
+    return lasso_hostLog_r(&lasso_hostDefault, fmt, a0, a1, a2);
+}
+#endif
+
+
+bool lasso_hostReadyForNotification (void) {
+    return lasso_hostReadyForNotification_r(&lasso_hostDefault);
+}
 #endif
+
+
+void lasso_hostSignalFinishedCOM (void) {
+    lasso_hostSignalFinishedCOM_r(&lasso_hostDefault);
+}
+
+
+void lasso_hostSetBuffer (
+    uint8_t* buffer         //!< external buffer pointer
+) {
+    lasso_hostSetBuffer_r(&lasso_hostDefault, buffer);
 }
-#endif
\ No newline at end of file
+
+
+void lasso_hostCountdown (
+    uint16_t count          //!< cycle counts to subtract from countdown
+) {
+    lasso_hostCountdown_r(&lasso_hostDefault, count);
+}
+
+
+void lasso_hostTickPeriod (
+    float period            //!< new tick period in [ms]
+) {
+    lasso_hostTickPeriod_r(&lasso_hostDefault, period);
+}
+
+
+void lasso_hostHandleCOM (void) {
+    lasso_hostHandleCOM_r(&lasso_hostDefault);
+}
+#endif
@@ -110,6 +110,9 @@
 
 #define LASSO_STROBE_DYNAMIC        (1)     //!< strobe adjusts to datacell periods
 
+#define LASSO_STROBE_DELTA          (2)     //!< strobe only holds changed datacells
+// same strobe layout as LASSO_STROBE_DYNAMIC, mask bit set if value changed
+
 
 //-------------------------------------------//
 // Definitions related to message processing //
@@ -123,6 +126,43 @@
 // note that there are still lots of references to a "future" third processing mode in lasso_host.c !
 
 
+//----------------------------------//
+// Definitions related to CRC engine //
+//----------------------------------//
+
+#define LASSO_CRC_USER              (0)     //!< user-supplied CRC callback
+
+#define LASSO_CRC_TABLE             (1)     //!< built-in table-driven CRC
+// see crc/crc.c for polynomials (MSB-first, initial value 0, no final XOR)
+
+
+//--------------------------------------//
+// Definitions related to link sharing  //
+//--------------------------------------//
+
+#define LASSO_LINK_PRIORITY         (0)     //!< strobe > response > notification
+
+#define LASSO_LINK_WEIGHTED         (1)     //!< frames scheduled by link share
+// see lasso_hostScheduleLink() in lasso_host.c
+
+
+//---------------------------------------------//
+// Definitions related to performance counters //
+//---------------------------------------------//
+
+// element index in "Perf" data cell (LASSO_HOST_PERF_COUNTERS)
+#define LASSO_PERF_STROBES              (0) //!< strobes sampled
+#define LASSO_PERF_STROBES_SKIPPED      (1) //!< strobes skipped (overdrive)
+#define LASSO_PERF_BUSY_RETRIES         (2) //!< transmissions deferred, COM busy
+#define LASSO_PERF_STROBE_BYTES         (3) //!< Bytes sent, strobes and advertising
+#define LASSO_PERF_RESPONSE_BYTES       (4) //!< Bytes sent, responses
+#define LASSO_PERF_NOTIFICATION_BYTES   (5) //!< Bytes sent, notifications
+#define LASSO_PERF_SAMPLE_CYCLES        (6) //!< cycles of last strobe sampling
+#define LASSO_PERF_SAMPLE_CYCLES_MAX    (7) //!< cycles of slowest strobe sampling
+#define LASSO_PERF_COMMAND_CYCLES       (8) //!< cycles of last command
+#define LASSO_PERF_COMMAND_CYCLES_MAX   (9) //!< cycles of slowest command
+#define LASSO_PERF_COUNTERS             (10)
+
 //-------------------------------------//
 // Include config for user application //
 //-------------------------------------//
@@ -161,6 +201,40 @@ typedef int32_t(*lasso_comCallback)(uint8_t*, uint32_t);
  */
 typedef uint32_t(*lasso_crcCallback)(uint8_t*, uint32_t);
 
+/*!
+ *  \brief  Callback for incremental CRC generation.
+ *
+ *          Continues CRC computation from a previous CRC value (0 at start),
+ *          such that strobe CRC can be computed while sampling data cells.
+ *          Result must equal lasso_crcCallback over all Bytes in one go.
+ *
+ *  \param[in]  CRC value over preceding Bytes
+ *  \param[in]  buffer pointer
+ *  \param[in]  number of Bytes to iterate over
+ *  \return     right-aligned 32-bit CRC value
+ */
+typedef uint32_t(*lasso_crcUpdateCallback)(uint32_t, const uint8_t*, uint32_t);
+
+/*!
+ *  \brief  Callback for reading a free-running hardware timer.
+ *
+ *          Called when a strobe is sampled and once per Lasso tick (ISR-
+ *          safe read of the counter register, no side effects).
+ *
+ *  \return     timer count (incrementing, wraps around at 2^32)
+ */
+typedef uint32_t(*lasso_timerCallback)(void);
+
+/*!
+ *  \brief  Callback for capture trigger (oscilloscope mode).
+ *
+ *          Called once per Lasso tick while capture is armed, right after
+ *          the sample has been taken.
+ *
+ *  \return     TRUE to trigger
+ */
+typedef bool(*lasso_trgCallback)(void);
+
 /*!
  *  \brief  Callback for strobe activation/deactivation event.
  *
@@ -180,6 +254,9 @@ typedef bool(*lasso_chgCallback)(void* const);
 /*!
  *  \brief  Callback for strobe period change event.
  *
+ *          Called for periods requested by the Lasso client and, with
+ *          LASSO_HOST_AUTOTUNE, for periods chosen by the autotuner.
+ *
  *  \param[in]  strobe period requested [lasso cycles]
  *  \return     strobe period to be set [lasso cycles]
  */
@@ -202,6 +279,110 @@ typedef int32_t(*lasso_cmdCallback)(uint8_t* cmd, uint8_t len);
  */
 typedef void(*lasso_ctlCallback)(uint8_t* ctrls);
 
+/*!
+ *  \brief  Callback for memory-to-memory copy of large data cells.
+ *
+ *          User-supplied copy (e.g. by DMA) is optional and must have
+ *          completed when returning 0. Any other return value makes the
+ *          Lasso host copy the data cell itself.
+ *          Pointers and number of Bytes are LongWord-aligned, unless the
+ *          data cell is of 1-Byte type (i.e. 32-bit transfers can be used).
+ *
+ *  \param[in]  destination pointer (strobe buffer)
+ *  \param[in]  source pointer (memory cell)
+ *  \param[in]  number of Bytes to copy
+ *  \return     0 (copy done) or any other error code
+ */
+typedef int32_t(*lasso_memcpyCallback)(uint8_t*, const void*, uint32_t);
+
+/*!
+ *  \brief  Segment of a scatter-gather strobe transmission.
+ */
+typedef struct {
+    const uint8_t* ptr;         //!< segment start address (memory cell)
+    uint32_t len;               //!< number of Bytes in segment
+} lasso_segment;
+
+/*!
+ *  \brief  Callback for scatter-gather serial line transmission trigger.
+ *
+ *          Used for strobes instead of lasso_comCallback when
+ *          LASSO_HOST_STROBE_SCATTER_GATHER is enabled. Segments must be
+ *          transmitted in order, without gaps, directly from memory cells.
+ *
+ *  \param[in]  segment list start address
+ *  \param[in]  number of segments in list
+ *  \return     0 (no error), 16 (EBUSY, errno.h), -1 (any other error)
+ */
+typedef int32_t(*lasso_sgCallback)(const lasso_segment*, uint32_t);
+
+/*!
+ *  \brief  Callback polling the serial line transmitter.
+ *
+ *          Replaces a transmission complete interrupt: if supplied, it is
+ *          polled by lasso_hostHandleCOM() on every tick, which then calls
+ *          lasso_hostSignalFinishedCOM() itself.
+ *
+ *  \return     TRUE if last transmission has completed, FALSE if busy
+ */
+typedef bool(*lasso_txIdle)(void);
+
+/*!
+ *  \brief  Transmit backend, i.e. the serial line driver of a target.
+ *
+ *          Bundles the target-specific operations of the transmit path,
+ *          registered with lasso_hostRegisterTX(). Target files export one
+ *          const instance each, e.g. lasso_txBackend_PSoC6.
+ */
+typedef struct {
+    lasso_comSetup    setup;    //!< setup serial line (and DMA), mandatory
+    lasso_comCallback start;    //!< start transmission of a frame, mandatory
+    lasso_txIdle      idle;     //!< poll transmitter, NULL if completion ISR calls lasso_hostSignalFinishedCOM()
+    lasso_sgCallback  sg;       //!< start scatter-gather strobe, NULL if not supported
+} lasso_txBackend;
+
+#if (LASSO_HOST_DATASPACE_STATIC == 1)
+/*!
+ *  \brief  Data cell of a const dataspace table (may reside in flash).
+ *
+ *          Entries are declared with LASSO_DATACELL(), e.g.
+ *          static const lasso_dataCell dataspace[] = {
+ *              LASSO_DATACELL(LASSO_FLOAT, 1, &speed, "Speed", "m/s", NULL, 1),
+ *              ...
+ *          };
+ *          and registered with lasso_hostRegisterDataspace().
+ */
+typedef struct {
+    uint16_t ctrl;              //!< see definitions related to data cells
+    uint16_t count;             //!< data cell can be array of atomic type
+    const void* ptr;            //!< pointer to underlying memory cell
+    const char* name;           //!< data cell name string
+    const char* unit;           //!< data cell unit string
+    lasso_chgCallback onChange; //!< callback for change event
+    uint32_t update_rate;       //!< update rate of underlying memory cell (16/16 bits)
+} lasso_dataCell;
+
+// control code as lasso_hostRegisterDataCell() would store it
+#define LASSO_DATACELL_CTRL(type)       (((type) ^ LASSO_DATACELL_NOSTROBE) | \
+                                         (((type) & LASSO_DATACELL_PERMANENT) ? LASSO_DATACELL_STROBE : 0))
+
+// same arguments as lasso_hostRegisterDataCell() (update rate ignored if
+// LASSO_STROBE_STATIC)
+#if (LASSO_HOST_STROBE_DYNAMICS == LASSO_STROBE_STATIC)
+    #define LASSO_DATACELL(type, count, ptr, name, unit, onChange, update_rate) \
+        { LASSO_DATACELL_CTRL(type), (count), (ptr), (name), (unit), (onChange), (1UL << 16) + 1 }
+#else
+    #define LASSO_DATACELL(type, count, ptr, name, unit, onChange, update_rate) \
+        { LASSO_DATACELL_CTRL(type), (count), (ptr), (name), (unit), (onChange), \
+          ((uint32_t)(update_rate) << 16) + (update_rate) }
+#endif
+#endif
+
+/*!
+ *  \brief  Lasso host instance (opaque, one per serial link and dataspace).
+ */
+typedef struct LASSO_HOST lasso_host_t;
+
 
 //----------------------//
 // Public functions API //
@@ -228,6 +409,25 @@ int32_t lasso_hostRegisterCOM (
 #endif
 );
 
+/*!
+ *  \brief  Register transmit backend of a target.
+ *
+ *          Alternative to lasso_hostRegisterCOM(), which registers the
+ *          backend { cS, cC, NULL, NULL }.
+ *
+ *  \return Error code
+ */
+int32_t lasso_hostRegisterTX (
+    const lasso_txBackend* tx,  //!< transmit backend of target
+    lasso_actCallback aC,       //!< user-supplied callback on strobe activation
+#if (LASSO_HOST_STROBE_CRC_ENABLE == 1) || (LASSO_HOST_COMMAND_CRC_ENABLE == 1)
+    lasso_perCallback pC,       //!< user-supplied callback on period change
+    lasso_crcCallback rC        //!< user-supplied CRC generator
+#else
+    lasso_perCallback pC        //!< user-supplied callback on period change
+#endif
+);
+
 /*!
  *  \brief  Register user-supplied callback for command received callback event.
  *
@@ -246,6 +446,79 @@ int32_t lasso_hostRegisterCTRLS (
     lasso_ctlCallback cC            //!< user-supplied CTRLS function
 );
 
+/*!
+ *  \brief  Register user-supplied callback for controls received in the
+ *          receive path (interrupt context of lasso_hostReceiveByte()).
+ *
+ *  \return Error code
+ */
+#if (LASSO_HOST_CONTROLS_SIZE > 0)
+int32_t lasso_hostRegisterCTRLSISR (
+    lasso_ctlCallback cC            //!< user-supplied CTRLS function
+);
+#endif
+
+/*!
+ *  \brief  Register user-supplied incremental CRC generator (e.g. CRC unit).
+ *
+ *  \return Error code
+ */
+#if (LASSO_HOST_STROBE_CRC_ENABLE == 1) || (LASSO_HOST_COMMAND_CRC_ENABLE == 1)
+int32_t lasso_hostRegisterCRC (
+    lasso_crcUpdateCallback uC      //!< user-supplied incremental CRC function
+);
+#endif
+
+/*!
+ *  \brief  Register user-supplied memory-to-memory copy function (e.g. DMA).
+ *
+ *  \return Error code
+ */
+#if (LASSO_HOST_MEMCPY_MIN_BYTES > 0)
+int32_t lasso_hostRegisterMEMCPY (
+    lasso_memcpyCallback mC         //!< user-supplied MEMCPY function
+);
+#endif
+
+/*!
+ *  \brief  Register user-supplied hardware timer for the timestamp data cell.
+ *
+ *          The timestamp is then latched from the timer when a strobe is
+ *          sampled, instead of counting ticks.
+ *
+ *  \return Error code
+ */
+#if (LASSO_HOST_TIMESTAMP_TIMER == 1)
+int32_t lasso_hostRegisterTIMER (
+    lasso_timerCallback tC          //!< user-supplied timer read function
+);
+#endif
+
+/*!
+ *  \brief  Register user-supplied scatter-gather strobe transmission function.
+ *
+ *  \return Error code
+ */
+#if (LASSO_HOST_STROBE_SCATTER_GATHER == 1)
+int32_t lasso_hostRegisterSG (
+    lasso_sgCallback sC             //!< user-supplied SG function
+);
+#endif
+
+/*!
+ *  \brief  Register user-supplied capture trigger (oscilloscope mode).
+ *
+ *          Used when capture is armed without a trigger datacell.
+ *
+ *  \return Error code
+ */
+#if (LASSO_HOST_CAPTURE_SIZE > 0)
+int32_t lasso_hostRegisterTRIG (
+    lasso_trgCallback tC            //!< user-supplied trigger function
+);
+#endif
+
+#if (LASSO_HOST_DATASPACE_STATIC == 0)
 /*!
  *  \brief  Registers a data cell (link to memory cell).
  *
@@ -257,13 +530,27 @@ int32_t lasso_hostRegisterDataCell (
     const void* ptr,                    //!< pointer to memory cell
     const char* const name,             //!< identifier string
     const char* const unit,             //!< unit string
-#if (LASSO_HOST_STROBE_DYNAMICS != LASSO_STROBE_DYNAMIC)
+#if (LASSO_HOST_STROBE_DYNAMICS == LASSO_STROBE_STATIC)
     const lasso_chgCallback onChange    //!< user callback for change event
 #else
     const lasso_chgCallback onChange,   //!< user callback for change event
     uint16_t update_rate                //!< update rate info
 #endif
 );
+#else
+/*!
+ *  \brief  Registers a const table of data cells as dataspace.
+ *
+ *          Replaces the lasso_hostRegisterDataCell() sequence, may only be
+ *          called once (per instance).
+ *
+ *  \return Error code
+ */
+int32_t lasso_hostRegisterDataspace (
+    const lasso_dataCell* table,        //!< data cells, see LASSO_DATACELL()
+    uint8_t count                       //!< number of data cells in table
+);
+#endif
 
 /*!
  *  \brief  Prepare host's memory spaces for serial transmission.
@@ -272,6 +559,28 @@ int32_t lasso_hostRegisterDataCell (
  */
 int32_t lasso_hostRegisterMEM (void);
 
+#if (LASSO_HOST_ARENA == 1)
+/*!
+ *  \brief  Register user-supplied memory region as Lasso host arena.
+ *
+ *          Only required if LASSO_HOST_ARENA_SIZE is 0, must be called
+ *          before any other lasso_hostRegisterXxx() function.
+ *
+ *  \return Error code
+ */
+int32_t lasso_hostRegisterArena (
+    void* mem,                  //!< start of memory region
+    uint32_t size               //!< size of memory region in Bytes
+);
+
+/*!
+ *  \brief  Get number of arena Bytes allocated so far (all instances).
+ *
+ *  \return Number of Bytes used
+ */
+uint32_t lasso_hostGetArenaUsed (void);
+#endif
+
 /*!
  *  \brief  Receive one char from user-supplied serial port.
  *
@@ -281,6 +590,37 @@ int32_t lasso_hostReceiveByte (
     uint8_t b                   //!< char from serial port
 );
 
+#if (LASSO_HOST_RECEIVE_RING_SIZE > 0)
+/*!
+ *  \brief  Receive a block of chars from user-supplied serial port.
+ *
+ *  \return Error code
+ */
+int32_t lasso_hostReceiveBlock (
+    const uint8_t* src,         //!< chars from serial port (e.g. RX DMA buffer)
+    uint32_t cnt                //!< number of chars
+);
+#endif
+
+#if (LASSO_HOST_SNAPSHOT == 1)
+/*!
+ *  \brief  Begin update of a group of data cells (non-blocking, ISR-safe).
+ *
+ *          Strobes never contain a partial update of data cells written
+ *          between lasso_hostPublishBegin() and lasso_hostPublishEnd().
+ *
+ *  \return Void
+ */
+void lasso_hostPublishBegin (void);
+
+/*!
+ *  \brief  End update of a group of data cells (non-blocking, ISR-safe).
+ *
+ *  \return Void
+ */
+void lasso_hostPublishEnd (void);
+#endif
+
 #if (LASSO_HOST_NOTIFICATIONS == 1)
 /*!
  *  \brief  Send a notification (error/debug msg) to Lasso client.
@@ -291,6 +631,22 @@ int32_t lasso_hostSendNotification (
     const char* msg             //!< notification string
 );
 
+#if (LASSO_HOST_NOTIFICATION_QUEUE > 0)
+/*!
+ *  \brief  Queue a notification for deferred formatting (ISR-safe).
+ *
+ *          Formatting and transmission take place in lasso_hostHandleCOM().
+ *
+ *  \return Error code
+ */
+int32_t lasso_hostLog (
+    const char* fmt,            //!< static format string (%d %i %u %x %X %c %%)
+    uint32_t a0,                //!< 1st argument
+    uint32_t a1,                //!< 2nd argument
+    uint32_t a2                 //!< 3rd argument
+);
+#endif
+
 /*!
 *  \brief  Check if Lasso Host is ready for transmission of a notification.
 *    
@@ -302,7 +658,8 @@ bool lasso_hostReadyForNotification (void);
 /*!
 *  \brief  Signal to Lasso host that serial COM has finished transmitting.
 *    
-*  Note: to be called by user code after transmission of each frame.
+*  Note: to be called by user code after transmission of each frame, unless
+*        the transmit backend polls the transmitter (see lasso_txIdle).
 *
 *  \return Void
 */
@@ -345,6 +702,194 @@ void lasso_hostTickPeriod (
 void lasso_hostHandleCOM (void);
 
 
+#if (LASSO_HOST_MULTI_INSTANCE == 1)
+/*!
+ *  \brief  Create an additional Lasso host instance.
+ *
+ *          The functions above operate on the default instance. Each
+ *          lasso_hostXxx_r() function below performs lasso_hostXxx() on
+ *          instance h. Instances are independent in dataspace, strobe
+ *          rate and serial link; they may be served from different
+ *          contexts (e.g. two UART ISRs) as long as one instance is not
+ *          served from two contexts concurrently.
+ *
+ *  \return Pointer to new instance, NULL if out of memory
+ */
+lasso_host_t* lasso_hostCreate (void);
+
+int32_t lasso_hostRegisterCOM_r (
+    lasso_host_t* h,            //!< Lasso host instance
+    lasso_comSetup cS,          //!< user-supplied function to setup serial COM
+    lasso_comCallback cC,       //!< user-supplied callback on COM transmission
+    lasso_actCallback aC,       //!< user-supplied callback on strobe activation
+#if (LASSO_HOST_STROBE_CRC_ENABLE == 1) || (LASSO_HOST_COMMAND_CRC_ENABLE == 1)
+    lasso_perCallback pC,       //!< user-supplied callback on period change
+    lasso_crcCallback rC        //!< user-supplied CRC generator
+#else
+    lasso_perCallback pC        //!< user-supplied callback on period change
+#endif
+);
+
+int32_t lasso_hostRegisterTX_r (
+    lasso_host_t* h,            //!< Lasso host instance
+    const lasso_txBackend* tx,  //!< transmit backend of target
+    lasso_actCallback aC,       //!< user-supplied callback on strobe activation
+#if (LASSO_HOST_STROBE_CRC_ENABLE == 1) || (LASSO_HOST_COMMAND_CRC_ENABLE == 1)
+    lasso_perCallback pC,       //!< user-supplied callback on period change
+    lasso_crcCallback rC        //!< user-supplied CRC generator
+#else
+    lasso_perCallback pC        //!< user-supplied callback on period change
+#endif
+);
+
+int32_t lasso_hostRegisterCMDRX_r (
+    lasso_host_t* h,                //!< Lasso host instance
+    lasso_cmdCallback cC            //!< user-supplied CMDRX function
+);
+
+int32_t lasso_hostRegisterCTRLS_r (
+    lasso_host_t* h,                //!< Lasso host instance
+    lasso_ctlCallback cC            //!< user-supplied CTRLS function
+);
+
+#if (LASSO_HOST_CONTROLS_SIZE > 0)
+int32_t lasso_hostRegisterCTRLSISR_r (
+    lasso_host_t* h,                //!< Lasso host instance
+    lasso_ctlCallback cC            //!< user-supplied CTRLS function
+);
+#endif
+
+#if (LASSO_HOST_STROBE_CRC_ENABLE == 1) || (LASSO_HOST_COMMAND_CRC_ENABLE == 1)
+int32_t lasso_hostRegisterCRC_r (
+    lasso_host_t* h,                //!< Lasso host instance
+    lasso_crcUpdateCallback uC      //!< user-supplied incremental CRC function
+);
+#endif
+
+#if (LASSO_HOST_MEMCPY_MIN_BYTES > 0)
+int32_t lasso_hostRegisterMEMCPY_r (
+    lasso_host_t* h,                //!< Lasso host instance
+    lasso_memcpyCallback mC         //!< user-supplied MEMCPY function
+);
+#endif
+
+#if (LASSO_HOST_TIMESTAMP_TIMER == 1)
+int32_t lasso_hostRegisterTIMER_r (
+    lasso_host_t* h,                //!< Lasso host instance
+    lasso_timerCallback tC          //!< user-supplied timer read function
+);
+#endif
+
+#if (LASSO_HOST_STROBE_SCATTER_GATHER == 1)
+int32_t lasso_hostRegisterSG_r (
+    lasso_host_t* h,                //!< Lasso host instance
+    lasso_sgCallback sC             //!< user-supplied SG function
+);
+#endif
+
+#if (LASSO_HOST_CAPTURE_SIZE > 0)
+int32_t lasso_hostRegisterTRIG_r (
+    lasso_host_t* h,                //!< Lasso host instance
+    lasso_trgCallback tC            //!< user-supplied trigger function
+);
+#endif
+
+#if (LASSO_HOST_DATASPACE_STATIC == 0)
+int32_t lasso_hostRegisterDataCell_r (
+    lasso_host_t* h,                    //!< Lasso host instance
+    uint16_t type,                      //!< memory cell type
+    uint16_t count,                     //!< array size
+    const void* ptr,                    //!< pointer to memory cell
+    const char* const name,             //!< identifier string
+    const char* const unit,             //!< unit string
+#if (LASSO_HOST_STROBE_DYNAMICS == LASSO_STROBE_STATIC)
+    const lasso_chgCallback onChange    //!< user callback for change event
+#else
+    const lasso_chgCallback onChange,   //!< user callback for change event
+    uint16_t update_rate                //!< update rate info
+#endif
+);
+#else
+int32_t lasso_hostRegisterDataspace_r (
+    lasso_host_t* h,                    //!< Lasso host instance
+    const lasso_dataCell* table,        //!< data cells, see LASSO_DATACELL()
+    uint8_t count                       //!< number of data cells in table
+);
+#endif
+
+int32_t lasso_hostRegisterMEM_r (
+    lasso_host_t* h             //!< Lasso host instance
+);
+
+int32_t lasso_hostReceiveByte_r (
+    lasso_host_t* h,            //!< Lasso host instance
+    uint8_t b                   //!< char from serial port
+);
+
+#if (LASSO_HOST_RECEIVE_RING_SIZE > 0)
+int32_t lasso_hostReceiveBlock_r (
+    lasso_host_t* h,            //!< Lasso host instance
+    const uint8_t* src,         //!< chars from serial port (e.g. RX DMA buffer)
+    uint32_t cnt                //!< number of chars
+);
+#endif
+
+#if (LASSO_HOST_SNAPSHOT == 1)
+void lasso_hostPublishBegin_r (
+    lasso_host_t* h             //!< Lasso host instance
+);
+
+void lasso_hostPublishEnd_r (
+    lasso_host_t* h             //!< Lasso host instance
+);
+#endif
+
+#if (LASSO_HOST_NOTIFICATIONS == 1)
+int32_t lasso_hostSendNotification_r (
+    lasso_host_t* h,            //!< Lasso host instance
+    const char* msg             //!< notification string
+);
+
+#if (LASSO_HOST_NOTIFICATION_QUEUE > 0)
+int32_t lasso_hostLog_r (
+    lasso_host_t* h,            //!< Lasso host instance
+    const char* fmt,            //!< static format string (%d %i %u %x %X %c %%)
+    uint32_t a0,                //!< 1st argument
+    uint32_t a1,                //!< 2nd argument
+    uint32_t a2                 //!< 3rd argument
+);
+#endif
+
+bool lasso_hostReadyForNotification_r (
+    lasso_host_t* h             //!< Lasso host instance
+);
+#endif
+
+void lasso_hostSignalFinishedCOM_r (
+    lasso_host_t* h             //!< Lasso host instance
+);
+
+void lasso_hostSetBuffer_r (
+    lasso_host_t* h,        //!< Lasso host instance
+    uint8_t* buffer         //!< external buffer pointer
+);
+
+void lasso_hostCountdown_r (
+    lasso_host_t* h,        //!< Lasso host instance
+    uint16_t count          //!< cycle counts to subtract from countdown
+);
+
+void lasso_hostTickPeriod_r (
+    lasso_host_t* h,        //!< Lasso host instance
+    float period            //!< new tick period in [ms]
+);
+
+void lasso_hostHandleCOM_r (
+    lasso_host_t* h         //!< Lasso host instance
+);
+#endif
+
+
 #ifdef __cplusplus
 }
 #endif
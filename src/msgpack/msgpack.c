@@ -962,4 +962,179 @@ int32_t PackWriterPutString (
     const char* str                 //!< Pointer to string.
 ) {
   return PackWriterPutRawBytes(writer, (uint8_t*)str, strlen(str));
-}
\ No newline at end of file
+}
+
+int32_t PackWriterOpenRawBytes (
+    struct S_PackWriter* writer,    //!< Pointer to pack writer.
+    uint32_t len                    //!< Number of raw bytes.
+) {
+    if (len <= 0x1F) {
+        // Fix raw
+        if (!PackWriterIsFull(writer, 1)) {
+            writer->cursor[0] = PACK_TYPE_RAW_FIX | (uint8_t)len;
+            writer->cursor += 1;
+        }
+        else {
+            return EIO;
+        }
+    }
+    else if (len <= 0xFF) {
+        // Raw 8
+        if (!PackWriterIsFull(writer, 2)) {
+            writer->cursor[0] = PACK_TYPE_RAW_8;
+            writer->cursor[1] = (uint8_t)len;
+            writer->cursor += 2;
+        }
+        else {
+            return EIO;
+        }
+    }
+    else if (len <= 0xFFFF) {
+        // Raw 16
+        if (!PackWriterIsFull(writer, 3)) {
+            writer->cursor[0] = PACK_TYPE_RAW_16;
+            writer->cursor[1] = (uint8_t)((len >> 8 & 0xFF));
+            writer->cursor[2] = (uint8_t)((len >> 0 & 0xFF));
+            writer->cursor += 3;
+        }
+        else {
+            return EIO;
+        }
+    }
+    else {
+        // Raw 32
+        if (!PackWriterIsFull(writer, 5)) {
+            writer->cursor[0] = PACK_TYPE_RAW_32;
+            writer->cursor[1] = (uint8_t)((len >> 24 & 0xFF));
+            writer->cursor[2] = (uint8_t)((len >> 16 & 0xFF));
+            writer->cursor[3] = (uint8_t)((len >> 8  & 0xFF));
+            writer->cursor[4] = (uint8_t)((len >> 0  & 0xFF));
+            writer->cursor += 5;
+        }
+        else {
+            return EIO;
+        }
+    }
+
+    return 0;
+}
+
+uint8_t PackGetFixedCode (
+    T_PackType type,                //!< Boolean, (un)signed integer or float.
+    uint32_t width                  //!< Byte width (1, 2, 4, 8).
+) {
+    switch (type) {
+        case E_PackTypeBoolean : {
+            return (width == 1) ? PACK_TYPE_BOOLEAN_FALSE : 0;
+        }
+        case E_PackTypeUnsignedInteger : {
+            switch (width) {
+                case 1 : return PACK_TYPE_UINT8;
+                case 2 : return PACK_TYPE_UINT16;
+                case 4 : return PACK_TYPE_UINT32;
+                case 8 : return PACK_TYPE_UINT64;
+                default : return 0;
+            }
+        }
+        case E_PackTypeSignedInteger : {
+            switch (width) {
+                case 1 : return PACK_TYPE_INT8;
+                case 2 : return PACK_TYPE_INT16;
+                case 4 : return PACK_TYPE_INT32;
+                case 8 : return PACK_TYPE_INT64;
+                default : return 0;
+            }
+        }
+        case E_PackTypeFloat : {
+            switch (width) {
+                case 4 : return PACK_TYPE_FLOAT;
+                case 8 : return PACK_TYPE_DOUBLE;
+                default : return 0;
+            }
+        }
+        default : {
+            return 0;
+        }
+    }
+}
+
+void PackWriterPutFixedUnchecked (
+    struct S_PackWriter* writer,    //!< Pointer to pack writer.
+    uint8_t code,                   //!< Type code from PackGetFixedCode().
+    const void* src,                //!< Pointer to first element.
+    uint32_t width,                 //!< Byte width of element.
+    uint32_t count                  //!< Number of elements.
+) {
+    uint8_t* cursor = writer->cursor;
+    uint32_t value;
+    uint64_t value64;
+
+    if (code == PACK_TYPE_BOOLEAN_FALSE) {
+        const uint8_t* b = (const uint8_t*)src;
+
+        while (count--) {
+            *cursor++ = *b++ ? PACK_TYPE_BOOLEAN_TRUE : PACK_TYPE_BOOLEAN_FALSE;
+        }
+        writer->cursor = cursor;
+        return;
+    }
+
+    switch (width) {
+        case 1 : {
+            const uint8_t* v = (const uint8_t*)src;
+
+            while (count--) {
+                cursor[0] = code;
+                cursor[1] = *v++;
+                cursor += 2;
+            }
+            break;
+        }
+        case 2 : {
+            const uint16_t* v = (const uint16_t*)src;
+
+            while (count--) {
+                value = *v++;
+                cursor[0] = code;
+                cursor[1] = (uint8_t)((value >> 8) & 0xFF);
+                cursor[2] = (uint8_t)((value >> 0) & 0xFF);
+                cursor += 3;
+            }
+            break;
+        }
+        case 4 : {
+            const uint32_t* v = (const uint32_t*)src;
+
+            while (count--) {
+                value = *v++;
+                cursor[0] = code;
+                cursor[1] = (uint8_t)((value >> 24) & 0xFF);
+                cursor[2] = (uint8_t)((value >> 16) & 0xFF);
+                cursor[3] = (uint8_t)((value >> 8)  & 0xFF);
+                cursor[4] = (uint8_t)((value >> 0)  & 0xFF);
+                cursor += 5;
+            }
+            break;
+        }
+        default : {
+            const uint64_t* v = (const uint64_t*)src;
+
+            while (count--) {
+                value64 = *v++;
+                cursor[0] = code;
+                cursor[1] = (uint8_t)((value64 >> 56) & 0xFF);
+                cursor[2] = (uint8_t)((value64 >> 48) & 0xFF);
+                cursor[3] = (uint8_t)((value64 >> 40) & 0xFF);
+                cursor[4] = (uint8_t)((value64 >> 32) & 0xFF);
+                cursor[5] = (uint8_t)((value64 >> 24) & 0xFF);
+                cursor[6] = (uint8_t)((value64 >> 16) & 0xFF);
+                cursor[7] = (uint8_t)((value64 >> 8)  & 0xFF);
+                cursor[8] = (uint8_t)((value64 >> 0)  & 0xFF);
+                cursor += 9;
+            }
+            break;
+        }
+    }
+
+    writer->cursor = cursor;
+}
@@ -305,6 +305,45 @@ int32_t PackWriterPutString (
     const char* str                 //!< Pointer to string.
 );
 
+/*!
+ *  \brief  Opens raw bytes (header only), the raw bytes are appended next.
+ *  \return Error code.
+ */
+int32_t PackWriterOpenRawBytes (
+    struct S_PackWriter* writer,    //!< Pointer to pack writer.
+    uint32_t len                    //!< Number of raw bytes.
+);
+
+/*!
+ *  \brief  Gets the type code of a fixed-width element.
+ *
+ *          Unlike PackWriterPut*(), the code does not depend on the value,
+ *          such that the packed size of an element only depends on its type.
+ *          Booleans yield the "false" code, see PackWriterPutFixedUnchecked().
+ *  \return Type code, 0 if type and width do not match.
+ */
+uint8_t PackGetFixedCode (
+    T_PackType type,                //!< Boolean, (un)signed integer or float.
+    uint32_t width                  //!< Byte width (1, 2, 4, 8).
+);
+
+/*!
+ *  \brief  Puts fixed-width elements without buffer checks (fast path).
+ *
+ *          Each element is read in its atomic width from an aligned source
+ *          and packed big-endian behind the type code. The caller ensures
+ *          buffer space of count * (1 + width) Bytes (count Bytes for
+ *          booleans), e.g. from a template computed once.
+ *  \return None.
+ */
+void PackWriterPutFixedUnchecked (
+    struct S_PackWriter* writer,    //!< Pointer to pack writer.
+    uint8_t code,                   //!< Type code from PackGetFixedCode().
+    const void* src,                //!< Pointer to first element.
+    uint32_t width,                 //!< Byte width of element.
+    uint32_t count                  //!< Number of elements.
+);
+
 #ifdef __cplusplus
 }
 #endif
@@ -87,6 +87,8 @@
 /******************************************************************************/
 
 #include "pxx.h"
+#include "lasso_host.h"
+#include "lasso_defaults.h"  // for LASSO_HOST_CONTROLS_SIZE (PXX_setControls())
 
 
 #if !defined(RADIO_MODULE_LOCATION)
@@ -136,6 +138,9 @@
 #if !defined(RADIO_RECEIVER_ID)
     #error "Must define RADIO_RECEIVER_ID in radio_config.h"
 #endif
+#if (LASSO_HOST_CONTROLS_SIZE > 0) && (LASSO_HOST_CONTROLS_SIZE < 2 * RADIO_CHANNELS)
+    #error "LASSO_HOST_CONTROLS_SIZE must be at least 2 * RADIO_CHANNELS for PXX_setControls()"
+#endif
 
 
 
@@ -154,6 +159,11 @@
 #define FAILSAFE_CHANNEL_HOLD               2000
 #define FAILSAFE_CHANNEL_NOPULSE            2001
 
+// worst case bitstream length in Bytes: start bit and preamble (13 bits),
+// two syncs (2 x 22 bits), 18 Bytes of 1-bits (18 x 8 x 3 bits) with 28
+// stuffed 0-bits (28 x 2 bits), rounded up
+#define PXX_BITSTREAM_BYTES                 (69)
+
 
 /******************************************************************************/
 /* Private constants                                                          */
@@ -210,6 +220,60 @@ const uint16_t CRCTable_Short[] = {
    0x8C48, 0x9DC1, 0xAF5A, 0xBED3, 0xCA6C, 0xDBE5, 0xE97E, 0xF8F7
 };
 
+/*
+ * Expansion of a nibble (msb first) into serial bits (0 -> 01, 1 -> 001),
+ * including bit stuffing (0 after five 1-bits), for each number of 1-bits
+ * preceding the nibble. Each entry holds the serial bits (right-aligned),
+ * their number (8...14) and the number of trailing 1-bits after the nibble.
+ * A nibble holds at most one stuffed bit. 80 entries, 320 Bytes of flash.
+ */
+typedef struct S_PCM_EXPANSION {
+    uint16_t bits;
+    uint8_t len;
+    uint8_t ones;
+} pcmExpansion;
+
+static const pcmExpansion pcmExpansionTable[5][16] = {
+    {   // 0 preceding 1-bits
+        {0x0055,  8, 0}, {0x00A9,  9, 1}, {0x00A5,  9, 0}, {0x0149, 10, 2},
+        {0x0095,  9, 0}, {0x0129, 10, 1}, {0x0125, 10, 0}, {0x0249, 11, 3},
+        {0x0055,  9, 0}, {0x00A9, 10, 1}, {0x00A5, 10, 0}, {0x0149, 11, 2},
+        {0x0095, 10, 0}, {0x0129, 11, 1}, {0x0125, 11, 0}, {0x0249, 12, 4},
+    },
+    {   // 1 preceding 1-bit
+        {0x0055,  8, 0}, {0x00A9,  9, 1}, {0x00A5,  9, 0}, {0x0149, 10, 2},
+        {0x0095,  9, 0}, {0x0129, 10, 1}, {0x0125, 10, 0}, {0x0249, 11, 3},
+        {0x0055,  9, 0}, {0x00A9, 10, 1}, {0x00A5, 10, 0}, {0x0149, 11, 2},
+        {0x0095, 10, 0}, {0x0129, 11, 1}, {0x0125, 11, 0}, {0x0925, 14, 0},
+    },
+    {   // 2 preceding 1-bits
+        {0x0055,  8, 0}, {0x00A9,  9, 1}, {0x00A5,  9, 0}, {0x0149, 10, 2},
+        {0x0095,  9, 0}, {0x0129, 10, 1}, {0x0125, 10, 0}, {0x0249, 11, 3},
+        {0x0055,  9, 0}, {0x00A9, 10, 1}, {0x00A5, 10, 0}, {0x0149, 11, 2},
+        {0x0095, 10, 0}, {0x0129, 11, 1}, {0x0495, 13, 0}, {0x0929, 14, 1},
+    },
+    {   // 3 preceding 1-bits
+        {0x0055,  8, 0}, {0x00A9,  9, 1}, {0x00A5,  9, 0}, {0x0149, 10, 2},
+        {0x0095,  9, 0}, {0x0129, 10, 1}, {0x0125, 10, 0}, {0x0249, 11, 3},
+        {0x0055,  9, 0}, {0x00A9, 10, 1}, {0x00A5, 10, 0}, {0x0149, 11, 2},
+        {0x0255, 12, 0}, {0x04A9, 13, 1}, {0x04A5, 13, 0}, {0x0949, 14, 2},
+    },
+    {   // 4 preceding 1-bits
+        {0x0055,  8, 0}, {0x00A9,  9, 1}, {0x00A5,  9, 0}, {0x0149, 10, 2},
+        {0x0095,  9, 0}, {0x0129, 10, 1}, {0x0125, 10, 0}, {0x0249, 11, 3},
+        {0x0155, 11, 0}, {0x02A9, 12, 1}, {0x02A5, 12, 0}, {0x0549, 13, 2},
+        {0x0295, 12, 0}, {0x0529, 13, 1}, {0x0525, 13, 0}, {0x0A49, 14, 3},
+    },
+};
+
+// serial bits of start bit "1" and preamble (four 1-bits, no stuffing)
+#define PCM_PREAMBLE_BITS                   (0x1249)
+#define PCM_PREAMBLE_LEN                    (13)
+
+// serial bits of sync 0x7E (no CRC, no stuffing)
+#define PCM_HEAD_BITS                       (0x124925)
+#define PCM_HEAD_LEN                        (22)
+
 
 /******************************************************************************/
 /* Private variables                                                          */
@@ -218,8 +282,12 @@ const uint16_t CRCTable_Short[] = {
 static uint8_t* pulseDataPtr;
 static uint8_t pulseDataBitCount;
 static uint8_t pulseDataOneCount;
-static uint8_t pulseData[59];
-static uint8_t pulseDataByte;
+#if (RADIO_MODULE_BAUDRATE == MODULE_BAUDRATE_HIGH) && (RADIO_CHANNELS > 8)
+static uint8_t pulseData[2 * PXX_BITSTREAM_BYTES + 1];  // two bitstreams, repeated tail Byte
+#else
+static uint8_t pulseData[PXX_BITSTREAM_BYTES];
+#endif
+static uint32_t pulseDataBits;
 static uint16_t pulseDataCrc;
 static uint8_t failsafeCount = 100;
 static txmodule module;
@@ -232,45 +300,34 @@ static txmodule module;
 // SPI lsb first or msb first ?
 // in pxx.cpp: lsb first but bits filled in opposite direction into data reg.
 
-// insert bits msb first, then shift out from SPI TX msb first
-static inline void pcmPutSerialBit(uint8_t bit) {
-    if (pulseDataBitCount--) {
-        pulseDataByte = (pulseDataByte << 1) | bit;
-    }
-    else {
-        *pulseDataPtr++ = pulseDataByte;
-        pulseDataByte = bit;
-        pulseDataBitCount = 7;  // 7 more bits to be filled in
-    }
-}
-
-// expand bits to 0 -> 01 (16us), 1 -> 001 (24us)
-static void pcmPutSerialPart(uint8_t bit) {
-    pcmPutSerialBit(0);
-    if (bit) {
-        pcmPutSerialBit(0);
+// insert serial bits msb first, then shift out from SPI TX msb first:
+// bits are collected in a 32-bit accumulator (at most 7 pending bits plus
+// up to 22 new ones) and written out as soon as a Byte is complete
+static inline void pcmPutSerialBits(uint32_t bits, uint8_t len) {
+    pulseDataBits = (pulseDataBits << len) | bits;
+    pulseDataBitCount += len;
+    while (pulseDataBitCount >= 8) {
+        pulseDataBitCount -= 8;
+        *pulseDataPtr++ = (uint8_t)(pulseDataBits >> pulseDataBitCount);
     }
-    pcmPutSerialBit(1);
 }
 
-// insert tail bits as ones
+// insert tail bits as ones (to complete last Byte)
 static void pcmPutSerialTail(void) {
-    while (pulseDataBitCount) {
-        pcmPutSerialBit(1);
+    if (pulseDataBitCount) {
+        pcmPutSerialBits((1 << (8 - pulseDataBitCount)) - 1, 8 - pulseDataBitCount);
     }
-    *pulseDataPtr++ = pulseDataByte;
 }
 
-// bit stuffing
-static void pcmPutBit(uint8_t bit) {
-    if (bit) {
-        pcmPutSerialPart(1);
-        if (++pulseDataOneCount < 5) {
-            return;         // don't stuff in a zero
-        }
-    }
-    pcmPutSerialPart(0);
-    pulseDataOneCount = 0;
+// Byte translation (msb first) with bit stuffing, two table lookups per Byte
+static void pcmPutBits(uint8_t byte) {
+    const pcmExpansion* e;
+
+    e = &pcmExpansionTable[pulseDataOneCount][byte >> 4];
+    pcmPutSerialBits(e->bits, e->len);
+    e = &pcmExpansionTable[e->ones][byte & 0x0F];
+    pcmPutSerialBits(e->bits, e->len);
+    pulseDataOneCount = e->ones;
 }
 
 static inline uint16_t CRCTable(uint8_t val) {
@@ -284,17 +341,14 @@ static void pcmPutByte(uint8_t byte) {
     // pulseDataCrc = (pulseDataCrc >> 8) ^ CRCTable[(pulseDataCrc ^ byte) & 0xFF];
     // Note: in case of reversed data, low and high Byte in pxxPutCrc must be
     //       inverted
-    for (uint8_t i=0; i<8; i++) {
-        pcmPutBit(byte & 0x80);
-        byte <<= 1;
-    }
+    pcmPutBits(byte);
 }
 
 static inline void pxxInitData(void) {
     pulseDataPtr = pulseData;
-    pulseDataBitCount = 8;
+    pulseDataBitCount = 0;
     pulseDataOneCount = 0;
-    pulseDataByte = 0;
+    pulseDataBits = 0;
 }
 
 static inline void pxxInitCrc(void) {
@@ -303,32 +357,15 @@ static inline void pxxInitCrc(void) {
 
 static inline void pxxPutHead(void) {
     // send 7E, do not CRC nor bit stuff
-    pcmPutSerialPart(0);
-    pcmPutSerialPart(1);
-    pcmPutSerialPart(1);
-    pcmPutSerialPart(1);
-    pcmPutSerialPart(1);
-    pcmPutSerialPart(1);
-    pcmPutSerialPart(1);
-    pcmPutSerialPart(0);
+    pcmPutSerialBits(PCM_HEAD_BITS, PCM_HEAD_LEN);
 }
 
 static inline void pxxPutCrcHigh(void) {
-    uint8_t byte = pulseDataCrc >> 8;
-
-    for (uint8_t i=0; i<8; i++) {
-        pcmPutBit(byte & 0x80);
-        byte <<= 1;
-    }
+    pcmPutBits(pulseDataCrc >> 8);
 }
 
 static inline void pxxPutCrcLow(void) {
-    uint8_t byte = pulseDataCrc & 0xFF;
-
-    for (uint8_t i=0; i<8; i++) {
-        pcmPutBit(byte & 0x80);
-        byte <<= 1;
-    }
+    pcmPutBits(pulseDataCrc & 0xFF);
 }
 
 static inline uint16_t limit(uint16_t min, uint16_t val, uint16_t max) {
@@ -347,16 +384,18 @@ static void pxxPutBitstream(uint8_t startChannel) {
 
     pxxInitCrc();
 
+    // A bitstream following another one in the buffer starts with a copy
+    // of the previous tail Byte (as sent by the former bitwise generator).
+    if (pulseDataPtr != pulseData) {
+        *pulseDataPtr = pulseDataPtr[-1];
+        pulseDataPtr++;
+    }
+
     // If first bit in bitstream is "0", as it happens in pxxPutHead(),
     // SPI TX seems to pull the line low for two clock cycles. The only
     // way to work around this is by inserting a "1" bit for a start.
-    pcmPutSerialBit(1);
-
-    // Preamble ??
-    pcmPutSerialPart(1);
-    pcmPutSerialPart(1);
-    pcmPutSerialPart(1);
-    pcmPutSerialPart(1);
+    // Preamble ?? (four 1-bits follow)
+    pcmPutSerialBits(PCM_PREAMBLE_BITS, PCM_PREAMBLE_LEN);
 
     // sync
     pxxPutHead();
@@ -535,6 +574,15 @@ void PXX_configureTXModule(void) {
     module.pxx.power    = RADIO_MODULE_POWER;
 }
 
+// decode Lasso controls frame payload straight into channel values:
+// RADIO_CHANNELS little-endian uint16 (usable as Lasso controls callback)
+void PXX_setControls(uint8_t* ctrls) {
+    for (int i=0; i<RADIO_CHANNELS; i++) {
+        module.ppm.channels[i] = (uint16_t)ctrls[0] | ((uint16_t)ctrls[1] << 8);
+        ctrls += 2;
+    }
+}
+
 uint8_t* PXX_getBufferPtr(void) {
     return pulseData;
 }
@@ -28,6 +28,7 @@ extern "C" {
 uint8_t PXX_putBitstream(void);
 void PXX_configureTXModule(void);
 uint8_t* PXX_getBufferPtr(void);
+void PXX_setControls(uint8_t* ctrls);
 void PXX_setBind(bool on);
 void PXX_setFailsafeHold(void);
 
@@ -0,0 +1,142 @@
+// -----------------
+// Lasso data server
+// -----------------
+// Host implementation - RTOS integration layer for FreeRTOS (any port)
+// Note:
+// 1) lasso_comSetup_FreeRTOS() creates a dedicated Lasso task which calls lasso_hostHandleCOM()
+//    every LASSO_HOST_TICK_PERIOD_MS (vTaskDelayUntil(), no periodic ISR required). Call it after
+//    lasso_hostRegisterMEM() and before vTaskStartScheduler(). The tick period must be a multiple
+//    of the FreeRTOS tick (configTICK_RATE_HZ), LASSO_HOST_ISR_PERIOD_DIVIDER is not used.
+// 2) Command handoff: the UART RX interrupt passes received chars to lasso_rxISR_FreeRTOS(), which
+//    puts them into a FreeRTOS queue (never blocks, chars are dropped if the queue is full). The
+//    Lasso task decodes them before each tick, so that command reception, command processing and
+//    strobing all run in Lasso task context and the Lasso host needs no lock.
+// 3) Transmission stays board-specific: pass the transmit backend of the respective target file
+//    (e.g. lasso_txBackend_PSoC6) to lasso_hostRegisterTX(). Its idle poll runs in Lasso task
+//    context, or its TX-complete interrupt calls lasso_hostSignalFinishedCOM() as usual.
+// 4) Producer tasks and ISRs never block on the Lasso host: they write data cells directly and
+//    bracket updates of related data cells with lasso_hostPublishBegin() / lasso_hostPublishEnd()
+//    (LASSO_HOST_SNAPSHOT), and send notifications with lasso_hostLog()
+//    (LASSO_HOST_NOTIFICATION_QUEUE). The remaining Lasso host API must only be called from the
+//    Lasso task (or before the scheduler is started).
+// 5) Strobe sampling retries while an update was completed meanwhile (seqlock), it cannot wait for
+//    a producer it has preempted itself. Producers of consistent cell groups should thus be ISRs,
+//    tasks of higher priority than the Lasso task, or run on another core.
+
+#include "lasso_host.h"
+
+#ifdef INCLUDE_LASSO_HOST
+
+#include <errno.h>
+
+#include "FreeRTOS.h"
+#include "task.h"
+#include "queue.h"
+
+// ------------------------------------- //
+// Modify to adapt to a specific project //
+// ------------------------------------- //
+#ifndef LASSO_FREERTOS_RX_QUEUE
+    #define LASSO_FREERTOS_RX_QUEUE     (64)    // received chars buffered between ticks
+#endif
+#ifndef LASSO_FREERTOS_STACK
+    #define LASSO_FREERTOS_STACK        (256)   // Lasso task stack in [words]
+#endif
+
+
+//-------------------//
+// Private Variables //
+//-------------------//
+static QueueHandle_t lasso_rxQueue = NULL;
+static TaskHandle_t  lasso_task = NULL;
+
+
+//--------------------------//
+// Module private functions //
+//--------------------------//
+
+// Lasso task: decodes received chars, then serves one Lasso tick per period
+static void lasso_task_FreeRTOS(void* arg)
+{
+    TickType_t wake = xTaskGetTickCount();
+    TickType_t period = pdMS_TO_TICKS(LASSO_HOST_TICK_PERIOD_MS);
+    uint8_t c;
+
+    (void)arg;
+
+    if (period == 0) {
+        period = 1;
+    }
+
+    for (;;) {
+        while (xQueueReceive(lasso_rxQueue, &c, 0) == pdTRUE) {
+            lasso_hostReceiveByte(c);
+        }
+
+        lasso_hostHandleCOM();
+
+        vTaskDelayUntil(&wake, period);
+    }
+}
+
+
+//-------------------------//
+// Module public functions //
+//-------------------------//
+
+// creates receive queue and Lasso task (priority e.g. tskIDLE_PRIORITY + 2)
+int32_t lasso_comSetup_FreeRTOS(UBaseType_t priority)
+{
+    if (lasso_task) {
+        return EALREADY;
+    }
+
+    lasso_rxQueue = xQueueCreate(LASSO_FREERTOS_RX_QUEUE, sizeof(uint8_t));
+    if (lasso_rxQueue == NULL) {
+        return ENOMEM;
+    }
+
+    if (xTaskCreate(lasso_task_FreeRTOS, "Lasso", LASSO_FREERTOS_STACK, NULL,
+                    priority, &lasso_task) != pdPASS) {
+        vQueueDelete(lasso_rxQueue);
+        lasso_rxQueue = NULL;
+        return ENOMEM;
+    }
+
+    return 0;
+}
+
+
+// to be called by UART RX interrupt for each char received
+int32_t lasso_rxISR_FreeRTOS(uint8_t c)
+{
+    if (lasso_rxQueue == NULL) {
+        return EAGAIN;
+    }
+
+    // no context switch requested: chars are only decoded at the next tick
+    if (xQueueSendFromISR(lasso_rxQueue, &c, NULL) != pdTRUE) {
+        return ENOSPC;
+    }
+
+    return 0;
+}
+
+
+// to be called by tasks (not ISRs) passing received chars, e.g. a USB CDC driver task
+int32_t lasso_rxTask_FreeRTOS(const uint8_t* src, uint32_t cnt)
+{
+    if (lasso_rxQueue == NULL) {
+        return EAGAIN;
+    }
+
+    while (cnt--) {
+        if (xQueueSend(lasso_rxQueue, src++, 0) != pdTRUE) {
+            return ENOSPC;
+        }
+    }
+
+    return 0;
+}
+
+#endif
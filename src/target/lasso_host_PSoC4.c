@@ -52,6 +52,22 @@ int32_t lasso_comCallback_PSoC4(uint8_t* src, uint32_t cnt)
 }
 
 
+// polls transmission, frame buffer is released once DMA has emptied it into UART TX buffer
+bool lasso_txIdle_PSoC4(void)
+{
+    return (LASSO_UART_SpiUartGetTxBufferSize() == 0);
+}
+
+
+// transmit backend, see lasso_hostRegisterTX()
+const lasso_txBackend lasso_txBackend_PSoC4 = {
+    .setup = lasso_comSetup_PSoC4,
+    .start = lasso_comCallback_PSoC4,
+    .idle  = lasso_txIdle_PSoC4,
+    .sg    = NULL
+};
+
+
 // computes CRC-16-CCITT over buffer (polynome coefficients 0x1021/0x11021)
 // the running crc in local variable c must be truncated to desired byte-width in each round
 uint32_t lasso_crcCallback_PSoC4(uint8_t* src, uint32_t cnt) {
@@ -122,6 +122,21 @@ int32_t lasso_comCallback_PSoC4_no_DMA(uint8_t* src, uint32_t cnt) {
 }
 
 
+// polls transmission, frame buffer is released once TX ISR has copied it into UART TX buffer
+bool lasso_txIdle_PSoC4_no_DMA(void) {
+    return (bufcnt == 0);
+}
+
+
+// transmit backend, see lasso_hostRegisterTX()
+const lasso_txBackend lasso_txBackend_PSoC4_no_DMA = {
+    .setup = lasso_comSetup_PSoC4_no_DMA,
+    .start = lasso_comCallback_PSoC4_no_DMA,
+    .idle  = lasso_txIdle_PSoC4_no_DMA,
+    .sg    = NULL
+};
+
+
 // computes CRC-16-CCITT over buffer (polynome coefficients 0x1021/0x11021)
 // the running crc in local variable c must be truncated to desired byte-width in each round
 uint32_t lasso_crcCallback_PSoC4(uint8_t* src, uint32_t cnt) {
@@ -113,6 +113,16 @@ int32_t lasso_comCallback_PSoC5(uint8_t* src, uint32_t cnt)
 }
 
 
+// transmit backend, see lasso_hostRegisterTX()
+// (no idle poll, transfer end ISR calls lasso_hostSignalFinishedCOM())
+const lasso_txBackend lasso_txBackend_PSoC5 = {
+    .setup = lasso_comSetup_PSoC5,
+    .start = lasso_comCallback_PSoC5,
+    .idle  = NULL,
+    .sg    = NULL
+};
+
+
 // computes CRC-16-CCITT over buffer (polynome coefficients 0x1021/0x11021)
 // the running crc in local variable c must be truncated to desired byte-width in each round
 uint32_t lasso_crcCallback_PSoC5(uint8_t* src, uint32_t cnt) {
@@ -21,6 +21,14 @@
 #include <stdio.h>      // for using printf(), if desired
     
     
+#if (LASSO_HOST_STROBE_SCATTER_GATHER == 1)
+// Descriptor chain for scatter-gather strobe transmission
+// NOTE: each descriptor moves at most 65536 Bytes (2D: 256 x 256), plus one
+//       1D descriptor for the remainder, i.e. up to 2 descriptors per segment
+#define LASSO_SG_DESCRIPTORS_PSOC6  (32)
+static cy_stc_dma_descriptor_t SGDescriptors[LASSO_SG_DESCRIPTORS_PSOC6];
+#endif
+
 //--------------------------//
 // Module private functions //
 //--------------------------//    
@@ -71,6 +79,17 @@ int32_t lasso_comSetup_PSoC6(void)
     LASSO_DMA_SetXloopSrcIncrement(&LASSO_DMA_Descriptor_2, 1);
     LASSO_DMA_SetXloopDstIncrement(&LASSO_DMA_Descriptor_2, 0);    
     
+#if (LASSO_HOST_MEMCPY_MIN_BYTES > 0)
+    // start second DMA channel for memory-to-memory copies of large data cells
+    // (component LASSO_MEMCPY_DMA, 1D transfer, trigger by software)
+    LASSO_MEMCPY_DMA_Init();
+    
+    LASSO_MEMCPY_DMA_SetDescriptorType(&LASSO_MEMCPY_DMA_Descriptor_1, CY_DMA_1D_TRANSFER);
+    LASSO_MEMCPY_DMA_SetInterruptType(&LASSO_MEMCPY_DMA_Descriptor_1, CY_DMA_DESCR);
+    LASSO_MEMCPY_DMA_SetNextDescriptor(&LASSO_MEMCPY_DMA_Descriptor_1);
+    LASSO_MEMCPY_DMA_SetChannelState(&LASSO_MEMCPY_DMA_Descriptor_1, CY_DMA_CHANNEL_DISABLED);
+#endif
+    
     // start ISR for periodic communication
     if (CY_SYSINT_SUCCESS != Cy_SysInt_Init(&LASSO_ISR_cfg, &LASSO_ISR_handler)) {
         while(1); // Handle possible errors
@@ -145,6 +164,144 @@ int32_t lasso_comCallback_PSoC6(uint8_t* src, uint32_t cnt)
 }
 
 
+#if (LASSO_HOST_MEMCPY_MIN_BYTES > 0)
+// copies data cell to strobe buffer via DMA (software trigger) and waits for completion
+// uses 32-bit transfers when pointers and count are LongWord-aligned (preserves atomic access)
+// note that a 1D descriptor transfers at most 256 items, larger copies are left to the host
+int32_t lasso_memcpyCallback_PSoC6(uint8_t* dest, const void* src, uint32_t cnt)
+{
+    uint32_t items = cnt;
+    cy_en_dma_data_size_t size = CY_DMA_BYTE;
+    
+    if ((((uint32_t)dest | (uint32_t)src | cnt) & 3) == 0) {
+        items = cnt >> 2;
+        size = CY_DMA_WORD;
+    }
+    
+    if ((items == 0) || (items > 256)) {
+        return EINVAL;
+    }
+    
+    LASSO_MEMCPY_DMA_SetSrcAddress(&LASSO_MEMCPY_DMA_Descriptor_1, src);
+    LASSO_MEMCPY_DMA_SetDstAddress(&LASSO_MEMCPY_DMA_Descriptor_1, (const void*)dest);
+    LASSO_MEMCPY_DMA_SetDataSize(&LASSO_MEMCPY_DMA_Descriptor_1, size);
+    LASSO_MEMCPY_DMA_SetXloopDataCount(&LASSO_MEMCPY_DMA_Descriptor_1, items);
+    LASSO_MEMCPY_DMA_SetXloopSrcIncrement(&LASSO_MEMCPY_DMA_Descriptor_1, 1);
+    LASSO_MEMCPY_DMA_SetXloopDstIncrement(&LASSO_MEMCPY_DMA_Descriptor_1, 1);
+    
+    // enable channel and trigger transfer by software,
+    // channel gets disabled automatically when done
+    LASSO_MEMCPY_DMA_ChannelEnable();
+    Cy_TrigMux_SwTrigger(LASSO_MEMCPY_DMA_DW__TR_IN, CY_TRIGGER_TWO_CYCLES);
+    
+    // copy must be complete on return (descriptor completion raises interrupt flag)
+    while (Cy_DMA_Channel_GetInterruptStatus(LASSO_MEMCPY_DMA_HW, LASSO_MEMCPY_DMA_DW_CHANNEL) == 0);
+    Cy_DMA_Channel_ClearInterrupt(LASSO_MEMCPY_DMA_HW, LASSO_MEMCPY_DMA_DW_CHANNEL);
+    
+    return 0;
+}
+#endif
+
+
+#if (LASSO_HOST_STROBE_SCATTER_GATHER == 1)
+// configures and triggers chained DMA transmission of strobe segments on UART, or, if still transmitting, returns busy error code
+// note that the number of descriptors is limited by LASSO_SG_DESCRIPTORS_PSOC6 and segments must be <= 65536 Bytes
+int32_t lasso_sgCallback_PSoC6(const lasso_segment* seg, uint32_t cnt)
+{
+    cy_stc_dma_descriptor_config_t config = {
+        .retrigger       = CY_DMA_RETRIG_IM,
+        .interruptType   = CY_DMA_DESCR_CHAIN,
+        .triggerOutType  = CY_DMA_1ELEMENT,
+        .channelState    = CY_DMA_CHANNEL_ENABLED,
+        .triggerInType   = CY_DMA_1ELEMENT,
+        .dataSize        = CY_DMA_BYTE,
+        .srcTransferSize = CY_DMA_TRANSFER_SIZE_DATA,
+        .dstTransferSize = CY_DMA_TRANSFER_SIZE_DATA,
+        .dstAddress      = (void*)CYREG_SCB5_TX_FIFO_WR,
+        .srcXincrement   = 1,
+        .dstXincrement   = 0,
+        .srcYincrement   = 256,
+        .dstYincrement   = 0,
+    };
+    uint32_t d = 0;
+    uint32_t remainder;
+    
+    if (!LASSO_UART_IsTxComplete()) {
+        return EBUSY;
+    }
+    
+    if (cnt == 0) {
+        return 0;
+    }
+    
+    while (cnt--) {
+        if (seg->len > 65536) {
+            return EINVAL;
+        }
+        
+        // 2D descriptor for entire multiples of 256 Bytes
+        if (seg->len >= 256) {
+            if (d == LASSO_SG_DESCRIPTORS_PSOC6) {
+                return ENOMEM;
+            }
+            config.descriptorType = CY_DMA_2D_TRANSFER;
+            config.srcAddress     = (void*)seg->ptr;
+            config.xCount         = 256;
+            config.yCount         = seg->len >> 8;
+            config.nextDescriptor = &SGDescriptors[d + 1];
+            Cy_DMA_Descriptor_Init(&SGDescriptors[d++], &config);
+        }
+        
+        // 1D descriptor for the remainder
+        remainder = seg->len % 256;
+        if (remainder) {
+            if (d == LASSO_SG_DESCRIPTORS_PSOC6) {
+                return ENOMEM;
+            }
+            config.descriptorType = CY_DMA_1D_TRANSFER;
+            config.srcAddress     = (void*)(seg->ptr + seg->len - remainder);
+            config.xCount         = remainder;
+            config.nextDescriptor = &SGDescriptors[d + 1];
+            Cy_DMA_Descriptor_Init(&SGDescriptors[d++], &config);
+        }
+        
+        seg++;
+    }
+    
+    // last descriptor terminates the chain and disables the channel
+    Cy_DMA_Descriptor_SetNextDescriptor(&SGDescriptors[d - 1], NULL);
+    Cy_DMA_Descriptor_SetChannelState(&SGDescriptors[d - 1], CY_DMA_CHANNEL_DISABLED);
+    
+    // enabling channel triggers transfer to UART immediately,
+    // channel gets disabled automatically when done
+    Cy_DMA_Channel_SetDescriptor(LASSO_DMA_HW, LASSO_DMA_DW_CHANNEL, &SGDescriptors[0]);
+    LASSO_DMA_ChannelEnable();
+    
+    return 0;
+}
+#endif
+
+
+// polls transmission, frame buffer is released once UART has sent it
+bool lasso_txIdle_PSoC6(void)
+{
+    return LASSO_UART_IsTxComplete();
+}
+
+
+// transmit backend, see lasso_hostRegisterTX()
+const lasso_txBackend lasso_txBackend_PSoC6 = {
+    .setup = lasso_comSetup_PSoC6,
+    .start = lasso_comCallback_PSoC6,
+    .idle  = lasso_txIdle_PSoC6,
+#if (LASSO_HOST_STROBE_SCATTER_GATHER == 1)
+    .sg    = lasso_sgCallback_PSoC6
+#else
+    .sg    = NULL
+#endif
+};
+
+
 // computes CRC-16-CCITT over buffer (polynome coefficients 0x1021/0x11021)
 // the running crc in local variable c must be truncated to desired byte-width in each round
 uint32_t lasso_crcCallback_PSoC6(uint8_t* src, uint32_t cnt) {
@@ -167,4 +324,45 @@ uint32_t lasso_crcCallback_PSoC6(uint8_t* src, uint32_t cnt) {
     return c;
 }
 
+
+#if (LASSO_HOST_STROBE_CRC_ENABLE == 1) || (LASSO_HOST_COMMAND_CRC_ENABLE == 1)
+// incremental CRC on Crypto block, same parameters as Lasso host built-in
+// CRC engine (MSB-first, no reflection, no final XOR), seeded with running crc
+// NOTE: Crypto server must be running (Cy_Crypto_Init() and Cy_Crypto_Enable()
+//       called by application), polynomial, seed and result are MSB-aligned
+#define LASSO_CRC_SHIFT_PSOC6   (32 - 8 * LASSO_HOST_CRC_BYTEWIDTH)
+#if (LASSO_HOST_CRC_BYTEWIDTH == 1)
+#define LASSO_CRC_POLY_PSOC6    (0x07UL)
+#elif (LASSO_HOST_CRC_BYTEWIDTH == 2)
+#define LASSO_CRC_POLY_PSOC6    (0x1021UL)
+#else
+#define LASSO_CRC_POLY_PSOC6    (0x04C11DB7UL)
+#endif
+
+static cy_stc_crypto_context_crc_t CRCContext;
+static bool CRCReady = false;
+
+uint32_t lasso_crcUpdateCallback_PSoC6(uint32_t crc, const uint8_t* src, uint32_t cnt) {
+    uint32_t n;
+
+    if (!CRCReady) {
+        Cy_Crypto_Crc_Init(LASSO_CRC_POLY_PSOC6 << LASSO_CRC_SHIFT_PSOC6, 0u, 0u, 0u, 0UL, &CRCContext);
+        Cy_Crypto_Sync(CY_CRYPTO_SYNC_BLOCKING);
+        CRCReady = true;
+    }
+
+    // Crypto CRC processes up to 65535 Bytes per run
+    while (cnt) {
+        n = (cnt > 0xFFFF) ? 0xFFFF : cnt;
+        Cy_Crypto_Crc_Run((void*)src, (uint16_t)n, &crc, crc << LASSO_CRC_SHIFT_PSOC6, &CRCContext);
+        Cy_Crypto_Sync(CY_CRYPTO_SYNC_BLOCKING);
+        crc >>= LASSO_CRC_SHIFT_PSOC6;
+        src += n;
+        cnt -= n;
+    }
+
+    return crc;
+}
+#endif
+
 #endif
\ No newline at end of file
@@ -166,6 +166,16 @@ int32_t lasso_comCallback_PSoC6(uint8_t* src, uint32_t cnt)
 }
 
 
+// transmit backend, see lasso_hostRegisterTX()
+// (no idle poll, DMA ISR calls lasso_hostSignalFinishedCOM())
+const lasso_txBackend lasso_txBackend_PSoC6 = {
+    .setup = lasso_comSetup_PSoC6,
+    .start = lasso_comCallback_PSoC6,
+    .idle  = NULL,
+    .sg    = NULL
+};
+
+
 // computes CRC-16-CCITT over buffer (polynome coefficients 0x1021/0x11021)
 // the running crc in local variable c must be truncated to desired byte-width in each round
 uint32_t lasso_crcCallback_PSoC6(uint8_t* src, uint32_t cnt) {
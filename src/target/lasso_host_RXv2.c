@@ -25,6 +25,10 @@
 // DMA:
 // - DMACA FIT module must be activated by call to R_DMACA_Init()
 // - can transfer up to 65535 Bytes in one shot
+// Lasso host:
+// - register lasso_txBackend_RXv2 with lasso_hostRegisterTX(), end of DMA
+//   transfer is polled by lasso_hostHandleCOM() (no call to
+//   lasso_hostSignalFinishedCOM() required)
 
 #include "lasso_host.h"
 
@@ -215,6 +219,21 @@ int32_t lasso_comCallback_RXv2(uint8_t* src, uint32_t cnt) {
 }
 
 
+// polls transmission, frame buffer is released once DMA has moved last Byte to SCI
+bool lasso_txIdle_RXv2(void) {
+	return sci_dma_tend;
+}
+
+
+// transmit backend, see lasso_hostRegisterTX()
+const lasso_txBackend lasso_txBackend_RXv2 = {
+	.setup = lasso_comSetup_RXv2,
+	.start = lasso_comCallback_RXv2,
+	.idle  = lasso_txIdle_RXv2,
+	.sg    = NULL
+};
+
+
 // computes CRC-16-CCITT over buffer (polynome coefficients 0x1021/0x11021)
 // the running crc in local variable c must be truncated to desired byte-width in each round
 uint32_t lasso_crcCallback_RXv2(uint8_t* src, uint32_t cnt) {
@@ -238,10 +257,47 @@ uint32_t lasso_crcCallback_RXv2(uint8_t* src, uint32_t cnt) {
 }
 
 
+#if (LASSO_HOST_CRC_BYTEWIDTH < 4) && \
+    ((LASSO_HOST_STROBE_CRC_ENABLE == 1) || (LASSO_HOST_COMMAND_CRC_ENABLE == 1))
+// incremental CRC on CRC calculator, same parameters as Lasso host built-in
+// CRC engine (MSB-first, no reflection, no final XOR), seeded with running crc
+// NOTE: CRC-8 (X^8+X^2+X+1) and CRC-16-CCITT only, no CRC-32 in hardware
+uint32_t lasso_crcUpdateCallback_RXv2(uint32_t crc, const uint8_t* src, uint32_t cnt) {
+	static bool ready = false;
+
+	if (!ready) {
+		SYSTEM.PRCR.WORD = 0xA502;		// unlock module stop registers
+		MSTP(CRC) = 0;
+		SYSTEM.PRCR.WORD = 0xA500;
+		ready = true;
+	}
+
+	CRC.CRCCR.BIT.LMS = 1;				// MSB-first
+#if (LASSO_HOST_CRC_BYTEWIDTH == 1)
+	CRC.CRCCR.BIT.GPS = 1;				// X^8+X^2+X+1
+#else
+	CRC.CRCCR.BIT.GPS = 3;				// X^16+X^12+X^5+1
+#endif
+	CRC.CRCDOR = crc;					// seed
+
+	while (cnt--) {
+		CRC.CRCDIR = *src++;
+	}
+
+	return CRC.CRCDOR;
+}
+#endif
+
+
 int32_t lasso_rcvCallback_RXv2(void) {
 	// when UART char received, read it into lasso host
 	if (LASSO_SCI.SSR.BIT.RDRF) {
+#if (LASSO_HOST_RECEIVE_RING_SIZE > 0)
+		uint8_t b = LASSO_SCI.RDR;
+		lasso_hostReceiveBlock(&b, 1);		// decoded in lasso_hostHandleCOM()
+#else
 		lasso_hostReceiveByte(LASSO_SCI.RDR);
+#endif
 	}
 
 	return 0;
@@ -27,6 +27,13 @@
 #include "driverlib/gpio.h"
 #include "driverlib/pin_map.h"
 #include "driverlib/uart.h"
+
+// CRC module in CCM0 only available on TM4C129x
+#if defined(TARGET_IS_TM4C129_RA0) || defined(TARGET_IS_TM4C129_RA1) || \
+    defined(TARGET_IS_TM4C129_RA2)
+#define LASSO_CRC_CCM_TM4C
+#include "driverlib/crc.h"
+#endif
     
 // Allocate the uDMA channel control table.
 // NOTE: Table must be 1024-byte aligned.
@@ -34,6 +41,13 @@
 #pragma DATA_ALIGN(DMAControlTable, 1024)
 static uint8_t DMAControlTable[1024];    
 
+#if (LASSO_HOST_STROBE_SCATTER_GATHER == 1)
+// Task list for peripheral scatter-gather strobe transmission
+// NOTE: each task moves at most 1024 Bytes, segments are split accordingly
+#define LASSO_SG_TASKS_TM4C     (32)
+static tDMAControlTable SGTaskTable[LASSO_SG_TASKS_TM4C];
+#endif
+
 static void InitUART0(void) {
     // enable GPIOA and wait for peripheral to be ready
     ROM_SysCtlPeripheralEnable(SYSCTL_PERIPH_GPIOA);
@@ -99,6 +113,15 @@ static void InituDMA(void) {
     
     // The channel is not enabled here since transfer would begin immediately.
     // Refer to SysTickISRHandler()
+    
+#if (LASSO_HOST_MEMCPY_MIN_BYTES > 0)
+    // Software channel for memory-to-memory copies of large data cells.
+    // Control parameters (transfer size) are set per copy request.
+    ROM_uDMAChannelAttributeDisable(UDMA_CHANNEL_SW, UDMA_ATTR_USEBURST |
+                             UDMA_ATTR_ALTSELECT |
+                             UDMA_ATTR_HIGH_PRIORITY |
+                             UDMA_ATTR_REQMASK);
+#endif
 }
 
 
@@ -137,6 +160,114 @@ int32_t lasso_comCallback_TivaTM4C(uint8_t* src, uint32_t cnt) {
 }
 
 
+#if (LASSO_HOST_MEMCPY_MIN_BYTES > 0)
+// copies data cell to strobe buffer via uDMA software channel (AUTO mode) and waits for completion
+// uses 32-bit transfers when pointers and count are LongWord-aligned (preserves atomic access)
+// note that the uDMA transfers at most 1024 items per request, larger copies are left to the host
+int32_t lasso_memcpyCallback_TivaTM4C(uint8_t* dest, const void* src, uint32_t cnt) {
+    uint32_t items = cnt;
+    uint32_t ctrl = UDMA_SIZE_8 | UDMA_SRC_INC_8 | UDMA_DST_INC_8 | UDMA_ARB_8;
+    
+    if ((((uint32_t)dest | (uint32_t)src | cnt) & 3) == 0) {
+        items = cnt >> 2;
+        ctrl = UDMA_SIZE_32 | UDMA_SRC_INC_32 | UDMA_DST_INC_32 | UDMA_ARB_8;
+    }
+    
+    if ((items == 0) || (items > 1024)) {
+        return EINVAL;
+    }
+    
+    ROM_uDMAChannelControlSet(UDMA_CHANNEL_SW | UDMA_PRI_SELECT, ctrl);
+    ROM_uDMAChannelTransferSet(UDMA_CHANNEL_SW | UDMA_PRI_SELECT,
+                               UDMA_MODE_AUTO,
+                               (void*)src,
+                               (void*)dest,
+                               items);
+    
+    // enable channel and issue software request
+    ROM_uDMAChannelEnable(UDMA_CHANNEL_SW);
+    ROM_uDMAChannelRequest(UDMA_CHANNEL_SW);
+    
+    // copy must be complete on return (channel disables itself when done)
+    while (ROM_uDMAChannelIsEnabled(UDMA_CHANNEL_SW));
+    
+    return 0;
+}
+#endif
+
+
+#if (LASSO_HOST_STROBE_SCATTER_GATHER == 1)
+// configures and triggers peripheral scatter-gather DMA transmission on UART, or, if still transmitting, returns busy error code
+// note that the total number of tasks (segments split into chunks of 1024 Bytes max.) is limited by LASSO_SG_TASKS_TM4C
+int32_t lasso_sgCallback_TivaTM4C(const lasso_segment* seg, uint32_t cnt) {
+    uint32_t tasks = 0;
+    uint32_t mode = UDMA_MODE_PER_SCATTER_GATHER;
+    const uint8_t* src;
+    uint32_t len, num;
+    
+    if (ROM_UARTBusy(UART0_BASE)) {
+        return EBUSY;   
+    }
+    
+    while (cnt--) {
+        src = seg->ptr;
+        len = seg->len;
+        seg++;
+        
+        while (len) {
+            num = (len > 1024) ? 1024 : len;
+            len -= num;
+            
+            if (tasks == LASSO_SG_TASKS_TM4C) {
+                return ENOMEM;
+            }
+            
+            // last task runs in basic mode, which ends the scatter-gather sequence
+            if ((cnt == 0) && (len == 0)) {
+                mode = UDMA_MODE_BASIC;
+            }
+            
+            SGTaskTable[tasks++] = (tDMAControlTable)uDMATaskStructEntry(num, UDMA_SIZE_8,
+                                       UDMA_SRC_INC_8, (void*)src,
+                                       UDMA_DST_INC_NONE, (void*)(UART0_BASE + UART_O_DR),
+                                       UDMA_ARB_8, mode);
+            src += num;
+        }
+    }
+    
+    if (tasks == 0) {
+        return 0;
+    }
+    
+    ROM_uDMAChannelScatterGatherSet(UDMA_CHANNEL_UART0TX, tasks, SGTaskTable, 1);
+    
+    // enable channel
+    ROM_uDMAChannelEnable(UDMA_CHANNEL_UART0TX);
+    
+    return 0;
+}
+#endif
+
+
+// polls transmission, frame buffer is released once uDMA channel has disabled itself
+bool lasso_txIdle_TivaTM4C(void) {
+    return !ROM_uDMAChannelIsEnabled(UDMA_CHANNEL_UART0TX);
+}
+
+
+// transmit backend, see lasso_hostRegisterTX()
+const lasso_txBackend lasso_txBackend_TivaTM4C = {
+    .setup = lasso_comSetup_TivaTM4C,
+    .start = lasso_comCallback_TivaTM4C,
+    .idle  = lasso_txIdle_TivaTM4C,
+#if (LASSO_HOST_STROBE_SCATTER_GATHER == 1)
+    .sg    = lasso_sgCallback_TivaTM4C
+#else
+    .sg    = NULL
+#endif
+};
+
+
 // computes CRC-16-CCITT over buffer (polynome coefficients 0x1021/0x11021)
 // the running crc in local variable c must be truncated to desired byte-width in each round
 uint32_t lasso_crcCallback_TivaTM4C(uint8_t* src, uint32_t cnt) {
@@ -159,4 +290,32 @@ uint32_t lasso_crcCallback_TivaTM4C(uint8_t* src, uint32_t cnt) {
     return c;
 }
 
+
+#if defined(LASSO_CRC_CCM_TM4C) && (LASSO_HOST_CRC_BYTEWIDTH > 1) && \
+    ((LASSO_HOST_STROBE_CRC_ENABLE == 1) || (LASSO_HOST_COMMAND_CRC_ENABLE == 1))
+// incremental CRC on CCM0 CRC module, same parameters as Lasso host built-in
+// CRC engine (MSB-first, no reflection, no final XOR), seeded with running crc
+// NOTE: no CRC-8 polynomial 0x07 in hardware, use built-in CRC engine instead
+#if (LASSO_HOST_CRC_BYTEWIDTH == 2)
+#define LASSO_CRC_TYPE_TM4C     (CRC_CFG_TYPE_P1021)
+#else
+#define LASSO_CRC_TYPE_TM4C     (CRC_CFG_TYPE_P4C11DB7)
+#endif
+
+uint32_t lasso_crcUpdateCallback_TivaTM4C(uint32_t crc, const uint8_t* src, uint32_t cnt) {
+    static bool ready = false;
+
+    if (!ready) {
+        SysCtlPeripheralEnable(SYSCTL_PERIPH_CCM0);
+        while (!SysCtlPeripheralReady(SYSCTL_PERIPH_CCM0));
+        ready = true;
+    }
+
+    // Byte-wise input (any alignment), result read back from seed register
+    CRCConfigSet(CCM0_BASE, CRC_CFG_INIT_SEED | LASSO_CRC_TYPE_TM4C | CRC_CFG_SIZE_8BIT);
+    CRCSeedSet(CCM0_BASE, crc);
+    return CRCDataProcess(CCM0_BASE, (uint32_t*)src, cnt, false);
+}
+#endif
+
 #endif
@@ -30,6 +30,18 @@ int32_t lasso_comCallback_mbed(uint8_t* src, uint32_t cnt) {
     return 16; // EBUSY from errno.h
 }
 
+bool lasso_txIdle_mbed(void) {
+    return lasso_done;
+}
+
+// transmit backend, see lasso_hostRegisterTX()
+extern const lasso_txBackend lasso_txBackend_mbed = {
+    lasso_comSetup_mbed,
+    lasso_comCallback_mbed,
+    lasso_txIdle_mbed,
+    NULL
+};
+
 // computes CRC-16-CCITT over buffer (polynome coefficients 0x1021/0x11021)
 // the running crc in local variable c must be truncated to desired byte-width in each round
 uint32_t lasso_crcCallback_mbed(uint8_t* src, uint32_t cnt) {
@@ -0,0 +1,617 @@
+// -----------------
+// Lasso data server
+// -----------------
+// Host implementation - simulated target for POSIX systems (Linux, macOS, Cygwin)
+// Note:
+// 1) The serial link is simulated: a frame occupies the link for 10 bit times per Byte at the
+//    simulated baudrate (default LASSO_HOST_BAUDRATE), lasso_comCallback_posix() returns EBUSY
+//    meanwhile. Additional EBUSY returns can be injected at random (lasso_comSimulate_posix()).
+//    Scatter-gather strobes (lasso_comScatterGather_posix()) occupy the link like one frame of
+//    all segments.
+// 2) Frames are written to a file descriptor if one is set, e.g. the master side of a pseudo
+//    terminal opened with lasso_comOpenPTY_posix(): a Lasso client can connect to the slave
+//    side (printed on stdout). Otherwise frames are discarded after simulated transmission.
+// 3) Either call lasso_comPoll_posix() from the main loop (link runs on CLOCK_MONOTONIC, chars
+//    received on the pty are fed to the Lasso host), or advance simulated time explicitly with
+//    lasso_comAdvance_posix() (deterministic, used by the benchmark below).
+// 4) Compile with -DLASSO_POSIX_BENCHMARK for a benchmark main(), e.g.
+//      gcc -O2 -DLASSO_POSIX_BENCHMARK -I<config dir> -Isrc src/target/lasso_host_posix.c
+//          src/lasso_host.c src/encodings/cobs.c src/encodings/escs.c src/msgpack/msgpack.c
+//          src/crc/crc.c src/ascii/ascii.c -o lasso_bench
+//      ./lasso_bench [cells] [array size] [ticks] [baudrate] [EBUSY permille]
+//    Cell count and array size are swept by the command line, encodings, processing mode and CRC
+//    width are compile-time options: sweep them by rebuilding with different lasso_host_config.h.
+//    Cycles are read from the time stamp counter on x86, elsewhere nanoseconds are reported.
+// 5) lasso_crcCallback_posix() is a bitwise CRC with the polynomials of crc/crc.c (all CRC widths).
+
+#define _XOPEN_SOURCE 600   // for posix_openpt() and clock_gettime()
+
+#include "lasso_host.h"
+
+#ifdef INCLUDE_LASSO_HOST
+
+#include "lasso_defaults.h"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <termios.h>
+#include <time.h>
+#include <unistd.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+    #include <x86intrin.h>
+    #define LASSO_POSIX_CYCLES()    __rdtsc()
+#else
+    #define LASSO_POSIX_CYCLES()    lasso_posixNanos()
+#endif
+
+
+//-------------------//
+// Private Variables //
+//-------------------//
+static struct {
+    int      fd;            // output file descriptor (-1 = discard frames)
+    uint32_t baudrate;      // simulated baudrate
+    uint32_t busyPermille;  // probability of random EBUSY (per mille)
+    uint64_t now;           // simulated time [ns]
+    uint64_t busyUntil;     // end of current frame transmission [ns]
+    bool     pending;       // frame in transmission?
+    uint64_t frames;        // statistics: frames transmitted
+    uint64_t messages;      // statistics: messages completed (strobes may span several frames)
+    uint64_t bytes;         // statistics: Bytes transmitted
+    uint64_t busy;          // statistics: EBUSY returned
+} lasso_posixLink = {-1, LASSO_HOST_BAUDRATE, 0, 0, 0, false, 0, 0, 0, 0};
+
+
+//-------------------//
+// Private functions //
+//-------------------//
+
+// monotonic clock in ns
+static uint64_t lasso_posixNanos(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000u + (uint64_t)ts.tv_nsec;
+}
+
+
+//------------------//
+// Module functions //
+//------------------//
+
+// resets simulated link (file descriptor is kept)
+int32_t lasso_comSetup_posix(void)
+{
+    lasso_posixLink.now = 0;
+    lasso_posixLink.busyUntil = 0;
+    lasso_posixLink.pending = false;
+    lasso_posixLink.frames = 0;
+    lasso_posixLink.messages = 0;
+    lasso_posixLink.bytes = 0;
+    lasso_posixLink.busy = 0;
+    return 0;
+}
+
+
+// sets simulated baudrate and probability of random EBUSY returns (0...1000 per mille)
+void lasso_comSimulate_posix(uint32_t baudrate, uint32_t busyPermille)
+{
+    if (baudrate) {
+        lasso_posixLink.baudrate = baudrate;
+    }
+    lasso_posixLink.busyPermille = busyPermille;
+}
+
+
+// opens a pseudo terminal (raw mode), frames are written to its master side
+int32_t lasso_comOpenPTY_posix(void)
+{
+    struct termios tio;
+    int fd = posix_openpt(O_RDWR | O_NOCTTY);
+
+    if (fd < 0) {
+        return errno;
+    }
+    if (grantpt(fd) || unlockpt(fd) || tcgetattr(fd, &tio)) {
+        close(fd);
+        return errno;
+    }
+
+    // raw mode, no echo, no line editing, no CR/LF translation
+    tio.c_iflag &= ~(IGNBRK | BRKINT | PARMRK | ISTRIP | INLCR | IGNCR | ICRNL | IXON);
+    tio.c_oflag &= ~OPOST;
+    tio.c_lflag &= ~(ECHO | ECHONL | ICANON | ISIG | IEXTEN);
+    tio.c_cflag &= ~(CSIZE | PARENB);
+    tio.c_cflag |= CS8;
+    tcsetattr(fd, TCSANOW, &tio);
+
+    printf("Lasso host on %s\n", ptsname(fd));
+    lasso_posixLink.fd = fd;
+    return 0;
+}
+
+
+// sets output file descriptor (e.g. pipe or file), -1 to discard frames
+void lasso_comSetFD_posix(int fd)
+{
+    lasso_posixLink.fd = fd;
+}
+
+
+// simulates transmission of a frame, or, if still transmitting, returns busy error code
+int32_t lasso_comCallback_posix(uint8_t* src, uint32_t cnt)
+{
+    uint8_t last = src[cnt - 1];
+
+    if (lasso_posixLink.pending ||
+        ((lasso_posixLink.busyPermille) && ((uint32_t)(rand() % 1000) < lasso_posixLink.busyPermille)))
+    {
+        lasso_posixLink.busy++;
+        return EBUSY;
+    }
+
+    if (lasso_posixLink.fd >= 0) {
+        while (cnt) {
+            ssize_t n = write(lasso_posixLink.fd, src, cnt);
+            if (n < 0) {
+                if (errno == EINTR) continue;
+                return EIO;
+            }
+            lasso_posixLink.bytes += (uint32_t)n;
+            src += n;
+            cnt -= (uint32_t)n;
+            lasso_posixLink.busyUntil = lasso_posixLink.now +
+                (uint64_t)n * 10000000000u / lasso_posixLink.baudrate;
+        }
+    }
+    else {
+        lasso_posixLink.bytes += cnt;
+        lasso_posixLink.busyUntil = lasso_posixLink.now +
+            (uint64_t)cnt * 10000000000u / lasso_posixLink.baudrate;
+    }
+
+    lasso_posixLink.frames++;
+#if (LASSO_HOST_STROBE_ENCODING == LASSO_ENCODING_COBS)
+    if (last == 0x00) lasso_posixLink.messages++;   // extended COBS frames end with 0xFF
+#elif (LASSO_HOST_STROBE_ENCODING == LASSO_ENCODING_ESCS)
+    if (last == 0x7E) lasso_posixLink.messages++;   // ESCS frame parts end without delimiter
+#else
+    lasso_posixLink.messages++;
+    (void)last;
+#endif
+    lasso_posixLink.pending = true;
+    return 0;
+}
+
+
+// simulates scatter-gather transmission of a strobe (segments back to back as one frame),
+// or, if still transmitting, returns busy error code
+#if (LASSO_HOST_STROBE_SCATTER_GATHER == 1)
+int32_t lasso_comScatterGather_posix(const lasso_segment* seg, uint32_t cnt)
+{
+    uint64_t total = 0;
+
+    if (lasso_posixLink.pending ||
+        ((lasso_posixLink.busyPermille) && ((uint32_t)(rand() % 1000) < lasso_posixLink.busyPermille)))
+    {
+        lasso_posixLink.busy++;
+        return EBUSY;
+    }
+
+    for (; cnt; seg++, cnt--) {
+        const uint8_t* src = seg->ptr;
+        uint32_t len = seg->len;
+
+        while ((lasso_posixLink.fd >= 0) && len) {
+            ssize_t n = write(lasso_posixLink.fd, src, len);
+            if (n < 0) {
+                if (errno == EINTR) continue;
+                return EIO;
+            }
+            src += n;
+            len -= (uint32_t)n;
+        }
+        total += seg->len;
+    }
+
+    lasso_posixLink.bytes += total;
+    lasso_posixLink.busyUntil = lasso_posixLink.now + total * 10000000000u / lasso_posixLink.baudrate;
+    lasso_posixLink.frames++;
+    lasso_posixLink.messages++;     // strobe encoding is NONE
+    lasso_posixLink.pending = true;
+    return 0;
+}
+#endif
+
+
+// advances simulated time, signals end of transmission exactly when frames finish
+// (the host may start the next frame from lasso_hostSignalFinishedCOM())
+void lasso_comAdvance_posix(uint32_t ns)
+{
+    uint64_t end = lasso_posixLink.now + ns;
+
+    while (lasso_posixLink.pending && (lasso_posixLink.busyUntil <= end)) {
+        lasso_posixLink.now = lasso_posixLink.busyUntil;
+        lasso_posixLink.pending = false;
+        lasso_hostSignalFinishedCOM();
+    }
+    lasso_posixLink.now = end;
+}
+
+
+// transmit backend, see lasso_hostRegisterTX()
+// (no idle poll, lasso_comAdvance_posix() calls lasso_hostSignalFinishedCOM())
+const lasso_txBackend lasso_txBackend_posix = {
+    .setup = lasso_comSetup_posix,
+    .start = lasso_comCallback_posix,
+    .idle  = NULL,
+#if (LASSO_HOST_STROBE_SCATTER_GATHER == 1)
+    .sg    = lasso_comScatterGather_posix
+#else
+    .sg    = NULL
+#endif
+};
+
+
+// advances simulated link to real time and feeds received chars to Lasso host
+// call from main loop, in between lasso_hostHandleCOM() calls
+void lasso_comPoll_posix(void)
+{
+    static uint64_t last = 0;
+    uint64_t t = lasso_posixNanos();
+    uint8_t buf[64];
+
+    if (last == 0) last = t;
+    lasso_comAdvance_posix((uint32_t)(t - last));
+    last = t;
+
+    if (lasso_posixLink.fd >= 0) {
+        struct pollfd p = {lasso_posixLink.fd, POLLIN, 0};
+        while ((poll(&p, 1, 0) > 0) && (p.revents & POLLIN)) {
+            ssize_t i, n = read(lasso_posixLink.fd, buf, sizeof(buf));
+            if (n <= 0) break;
+        #if (LASSO_HOST_RECEIVE_RING_SIZE > 0)
+            lasso_hostReceiveBlock(buf, (uint32_t)n);
+            (void)i;
+        #else
+            for (i = 0; i < n; i++) {
+                lasso_hostReceiveByte(buf[i]);
+            }
+        #endif
+        }
+    }
+}
+
+
+// computes CRC over buffer, MSB-first, initial value 0, no final XOR (same as crc/crc.c)
+// polynomials: CRC-8 0x07, CRC-16-CCITT 0x1021, CRC-32 0x04C11DB7
+uint32_t lasso_crcCallback_posix(uint8_t* src, uint32_t cnt) {
+#if (LASSO_HOST_CRC_BYTEWIDTH == 1)
+    const uint32_t poly = 0x07;
+#elif (LASSO_HOST_CRC_BYTEWIDTH == 2)
+    const uint32_t poly = 0x1021;
+#else
+    const uint32_t poly = 0x04C11DB7;
+#endif
+    const uint32_t msb = 1UL << (8 * LASSO_HOST_CRC_BYTEWIDTH - 1);
+    uint32_t c = 0;
+    uint8_t i;
+
+    while (cnt--) {
+        c ^= (uint32_t)(*src++) << (8 * LASSO_HOST_CRC_BYTEWIDTH - 8);
+        for (i = 0; i < 8; i++) {
+            c = (c & msb) ? (c << 1) ^ poly : (c << 1);
+        }
+    }
+#if (LASSO_HOST_CRC_BYTEWIDTH < 4)
+    c &= (msb << 1) - 1;
+#endif
+    return c;
+}
+
+
+#ifdef LASSO_POSIX_BENCHMARK
+
+#include "encodings/cobs.h"
+#include "encodings/escs.h"
+#include "msgpack/msgpack.h"
+
+//-----------//
+// Benchmark //
+//-----------//
+
+#define BENCH_TICK_NS   ((uint32_t)(LASSO_HOST_TICK_PERIOD_MS * 1000000.0))
+
+static uint64_t bench_cycles;   // cycles spent in lasso_hostHandleCOM()
+static uint64_t bench_ns;       // ns spent in lasso_hostHandleCOM()
+static uint16_t bench_period;   // strobe period reported through perCallback
+static uint32_t bench_periods;  // number of strobe period changes
+
+// records strobe period changes (by Lasso client or autotuning)
+static uint16_t bench_perCallback(uint16_t period)
+{
+    bench_period = period;
+    bench_periods++;
+    return period;
+}
+
+// frames a command like a Lasso client would (encoding and CRC) and feeds it to the host
+// in LASSO_MSGPACK_MODE, cmd = opcode and (optional) single unsigned parameter
+static void bench_command(const char* cmd)
+{
+    uint8_t raw[LASSO_HOST_COMMAND_BUFFER_SIZE + 8];
+    uint8_t enc[2 * sizeof(raw) + 4];
+    uint32_t n, e = 0;
+
+#if (LASSO_HOST_PROCESSING_MODE == LASSO_MSGPACK_MODE)
+    struct S_PackWriter w;
+    PackWriterSetBuffer(&w, raw, LASSO_HOST_COMMAND_BUFFER_SIZE);
+    PackWriterOpen(&w, E_PackTypeArray, 2);
+    PackWriterPutUnsignedInteger(&w, (uint8_t)cmd[0]);
+    if (cmd[1]) {
+        PackWriterOpen(&w, E_PackTypeArray, 1);
+        PackWriterPutUnsignedInteger(&w, (uint32_t)strtoul(cmd + 1, NULL, 10));
+    }
+    else {
+        PackWriterOpen(&w, E_PackTypeArray, 0);
+    }
+    n = PackWriterGetOffset(&w);
+#else
+    n = (uint32_t)strlen(cmd);
+    memcpy(raw, cmd, n);
+#endif
+
+#if (LASSO_HOST_COMMAND_CRC_ENABLE == 1)
+    // big-endian CRC, such that CRC over entire frame is 0
+    uint32_t d = lasso_crcCallback_posix(raw, n);
+    for (uint32_t i = LASSO_HOST_CRC_BYTEWIDTH; i > 0; i--) {
+        raw[n++] = (uint8_t)(d >> (8 * (i - 1)));
+    }
+#endif
+
+#if (LASSO_HOST_COMMAND_ENCODING == LASSO_ENCODING_RN)
+    memcpy(enc, raw, n);
+    e = n;
+    enc[e++] = '\r';
+    enc[e++] = '\n';
+#elif (LASSO_HOST_COMMAND_ENCODING == LASSO_ENCODING_COBS)
+    e = COBS_encode_frame(enc, raw, n);
+#else
+    enc[e++] = 0x7E;
+    for (uint32_t i = 0; i < n; i++) {
+        if ((raw[i] == 0x7E) || (raw[i] == 0x7D)) {
+            enc[e++] = 0x7D;
+            enc[e++] = raw[i] ^ 0x20;
+        }
+        else {
+            enc[e++] = raw[i];
+        }
+    }
+    enc[e++] = 0x7E;
+#endif
+
+#if (LASSO_HOST_RECEIVE_RING_SIZE > 0)
+    lasso_hostReceiveBlock(enc, e);
+#else
+    for (uint32_t i = 0; i < e; i++) {
+        lasso_hostReceiveByte(enc[i]);
+    }
+#endif
+}
+
+// runs host for a number of ticks, accumulates time spent in lasso_hostHandleCOM()
+static void bench_run(uint32_t ticks)
+{
+    while (ticks--) {
+        uint64_t c = LASSO_POSIX_CYCLES();
+        uint64_t t = lasso_posixNanos();
+        lasso_hostHandleCOM();
+        bench_ns += lasso_posixNanos() - t;
+        bench_cycles += LASSO_POSIX_CYCLES() - c;
+        lasso_comAdvance_posix(BENCH_TICK_NS);
+    }
+}
+
+// times an encoder/decoder over payload sizes 16...4096
+static void bench_codecs(void)
+{
+    static uint8_t src[4096], dst[2 * 4096 + 16];
+    struct S_PackWriter w;
+    struct S_PackReader r;
+    T_PackLen len;
+    T_PackFloat f;
+    uint32_t i, k, size, reps;
+    uint64_t c;
+
+    for (i = 0; i < sizeof(src); i++) {
+        src[i] = (uint8_t)(i * 7);  // includes COBS/ESCS delimiters
+    }
+
+    printf("%8s %12s %12s %12s %12s %12s\n", "Bytes", "COBS", "ESCS", "CRC", "msgpack wr", "msgpack rd");
+    for (size = 16; size <= sizeof(src); size *= 4) {
+        reps = (1u << 20) / size;
+        printf("%8u", size);
+
+        c = LASSO_POSIX_CYCLES();
+        for (k = 0; k < reps; k++) COBS_encode_frame(dst, src, size);
+        printf(" %12.2f", (double)(LASSO_POSIX_CYCLES() - c) / ((double)reps * size));
+
+        c = LASSO_POSIX_CYCLES();
+        for (k = 0; k < reps; k++) ESCS_encode(src, dst, size);
+        printf(" %12.2f", (double)(LASSO_POSIX_CYCLES() - c) / ((double)reps * size));
+
+        c = LASSO_POSIX_CYCLES();
+        for (k = 0; k < reps; k++) src[0] ^= (uint8_t)lasso_crcCallback_posix(src, size);
+        printf(" %12.2f", (double)(LASSO_POSIX_CYCLES() - c) / ((double)reps * size));
+
+        // msgpack: floats (5 Bytes each after packing)
+        c = LASSO_POSIX_CYCLES();
+        for (k = 0; k < reps; k++) {
+            PackWriterSetBuffer(&w, dst, sizeof(dst));
+            PackWriterOpen(&w, E_PackTypeArray, size / 4);
+            for (i = 0; i < size / 4; i++) {
+                PackWriterPutFloat(&w, (T_PackFloat)i);
+            }
+        }
+        len = PackWriterGetOffset(&w);
+        printf(" %12.2f", (double)(LASSO_POSIX_CYCLES() - c) / ((double)reps * len));
+
+        c = LASSO_POSIX_CYCLES();
+        for (k = 0; k < reps; k++) {
+            PackReaderSetBuffer(&r, dst, len);
+            PackReaderOpen(&r, E_PackTypeArray, &i);
+            while (i--) {
+                PackReaderGetFloat(&r, &f);
+            }
+        }
+        printf(" %12.2f\n", (double)(LASSO_POSIX_CYCLES() - c) / ((double)reps * len));
+    }
+    printf("(cycles/Byte for payload, msgpack per packed Byte)\n\n");
+}
+
+int main(int argc, char** argv)
+{
+    uint32_t cells = (argc > 1) ? (uint32_t)strtoul(argv[1], NULL, 10) : 16;
+    uint32_t count = (argc > 2) ? (uint32_t)strtoul(argv[2], NULL, 10) : 1;
+    uint32_t ticks = (argc > 3) ? (uint32_t)strtoul(argv[3], NULL, 10) : 10000;
+    uint32_t baud  = (argc > 4) ? (uint32_t)strtoul(argv[4], NULL, 10) : LASSO_HOST_BAUDRATE;
+    uint32_t busy  = (argc > 5) ? (uint32_t)strtoul(argv[5], NULL, 10) : 0;
+    float* data;
+    char* names;
+    char cmd[16];
+    uint32_t i;
+    int32_t err;
+    uint64_t frames, strobes, bytes;
+    double sim_s;
+
+    printf("Lasso host benchmark: command encoding %u, strobe encoding %u, processing mode %u, CRC %u/%u x %u Bytes\n",
+        LASSO_HOST_COMMAND_ENCODING, LASSO_HOST_STROBE_ENCODING, LASSO_HOST_PROCESSING_MODE,
+        LASSO_HOST_COMMAND_CRC_ENABLE, LASSO_HOST_STROBE_CRC_ENABLE, LASSO_HOST_CRC_BYTEWIDTH);
+    printf("%u cells of float[%u], %u ticks of %.3f ms, %u baud, %u%% EBUSY\n\n",
+        cells, count, ticks, (double)LASSO_HOST_TICK_PERIOD_MS, baud, busy / 10);
+
+    bench_codecs();
+
+    // dataspace
+    if ((cells == 0) || (cells > 255) || (count == 0)) {
+        printf("invalid dataspace\n");
+        return EXIT_FAILURE;
+    }
+    data = calloc((size_t)cells * count, sizeof(float));
+    names = calloc(cells, 8);
+    if (!data || !names) {
+        return EXIT_FAILURE;
+    }
+
+#if (LASSO_HOST_ARENA == 1) && (LASSO_HOST_ARENA_SIZE == 0)
+    {
+        uint32_t size = LASSO_HOST_ARENA_BYTES(cells, cells * count * sizeof(float)) + 4096;
+        lasso_hostRegisterArena(malloc(size), size);
+    }
+#endif
+
+#if (LASSO_HOST_DATASPACE_STATIC == 1)
+    {
+        lasso_dataCell* table = calloc(cells, sizeof(lasso_dataCell));
+        if (!table) {
+            return EXIT_FAILURE;
+        }
+        for (i = 0; i < cells; i++) {
+            sprintf(names + 8 * i, "c%u", i);
+            table[i] = (lasso_dataCell)LASSO_DATACELL(LASSO_FLOAT, count, data + i * count, names + 8 * i, "", NULL, 1);
+        }
+        err = lasso_hostRegisterDataspace(table, (uint8_t)cells);
+    }
+#else
+    for (i = 0, err = 0; (i < cells) && (err == 0); i++) {
+        sprintf(names + 8 * i, "c%u", i);
+    #if (LASSO_HOST_STROBE_DYNAMICS == LASSO_STROBE_STATIC)
+        err = lasso_hostRegisterDataCell(LASSO_FLOAT, count, data + i * count, names + 8 * i, "", NULL);
+    #else
+        err = lasso_hostRegisterDataCell(LASSO_FLOAT, count, data + i * count, names + 8 * i, "", NULL, 1);
+    #endif
+    }
+#endif
+    if (err) {
+        printf("data cell registration failed (%d)\n", (int)err);
+        return EXIT_FAILURE;
+    }
+
+#if (LASSO_HOST_STROBE_CRC_ENABLE == 1) || (LASSO_HOST_COMMAND_CRC_ENABLE == 1)
+    err = lasso_hostRegisterTX(&lasso_txBackend_posix, NULL, bench_perCallback, lasso_crcCallback_posix);
+#else
+    err = lasso_hostRegisterTX(&lasso_txBackend_posix, NULL, bench_perCallback);
+#endif
+    if (err == 0) {
+        err = lasso_hostRegisterMEM();
+    }
+    if (err) {
+        printf("host setup failed (%d)\n", (int)err);
+        return EXIT_FAILURE;
+    }
+    lasso_comSimulate_posix(baud, busy);
+
+    // command interpretation: timing info requests, strobing off
+    bench_run(10);
+    bench_cycles = 0;
+    bench_ns = 0;
+    frames = lasso_posixLink.frames;
+    for (i = 0; i < 1000; i++) {
+        bench_command("t");
+        bench_run(LASSO_HOST_COMMAND_TIMEOUT_TICKS);
+    }
+    printf("commands: %u, %.0f cycles (%.0f ns) per command incl. idle ticks, %u frames sent\n",
+        1000, bench_cycles / 1000.0, bench_ns / 1000.0, (uint32_t)(lasso_posixLink.frames - frames));
+
+    // strobing at minimum period
+    sprintf(cmd, "P%u", (uint32_t)LASSO_HOST_STROBE_PERIOD_MIN_TICKS);
+    bench_command(cmd);
+    bench_run(LASSO_HOST_COMMAND_TIMEOUT_TICKS);
+    bench_command("W1");
+    bench_run(LASSO_HOST_COMMAND_TIMEOUT_TICKS);
+
+    bench_cycles = 0;
+    bench_ns = 0;
+    frames = lasso_posixLink.frames;
+    strobes = lasso_posixLink.messages;
+    bytes = lasso_posixLink.bytes;
+    lasso_posixLink.busy = 0;
+    bench_periods = 0;
+    for (i = 0; i < ticks; i++) {
+        data[i % (cells * count)] += 1.0f;
+        bench_run(1);
+    }
+    frames = lasso_posixLink.frames - frames;
+    strobes = lasso_posixLink.messages - strobes;
+    bytes = lasso_posixLink.bytes - bytes;
+    sim_s = (double)ticks * BENCH_TICK_NS * 1e-9;
+
+    bench_command("W0");
+    bench_run(LASSO_HOST_COMMAND_TIMEOUT_TICKS);
+
+    if ((strobes == 0) || (bytes == 0)) {
+        printf("no strobes transmitted\n");
+        return EXIT_FAILURE;
+    }
+    printf("strobes: %llu in %llu frames, %.1f Bytes/strobe, %llu EBUSY\n",
+        (unsigned long long)strobes, (unsigned long long)frames, (double)bytes / strobes,
+        (unsigned long long)lasso_posixLink.busy);
+    printf("period:  %u ticks at end, %u changes while strobing\n", bench_period, bench_periods);
+    printf("host:    %.2f cycles/Byte, %.0f cycles (%.0f ns) per tick\n",
+        (double)bench_cycles / bytes, (double)bench_cycles / ticks, (double)bench_ns / ticks);
+    printf("rate:    %.1f strobes/s achieved, %.1f strobes/s link-bound, %.1f strobes/s CPU-bound\n",
+        strobes / sim_s, baud / 10.0 / ((double)bytes / strobes), strobes * 1e9 / (double)bench_ns);
+
+    free(data);
+    free(names);
+    return EXIT_SUCCESS;
+}
+
+#endif
+
+#endif